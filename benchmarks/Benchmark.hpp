@@ -0,0 +1,124 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_BENCHMARKS_BENCHMARK_HPP
+#define NUCLEAR_BENCHMARKS_BENCHMARK_HPP
+
+#include <algorithm>
+#include <functional>
+#include <iomanip>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include "nuclear"
+
+namespace benchmark {
+
+/**
+ * @brief Collects the results of a single benchmark run and prints them as a line of JSON.
+ *
+ * @details
+ *  Each report is printed on its own line so the output of the benchmark executable can be stored and compared
+ *  between builds to find regressions.
+ */
+class Report {
+public:
+    Report(const std::string& name) : name(name) {}
+
+    /// @brief adds a parameter that describes how the benchmark was run (e.g. the number of threads)
+    Report& parameter(const std::string& key, double value) {
+        parameters.emplace_back(key, value);
+        return *this;
+    }
+
+    /// @brief adds a measured value to the report
+    Report& metric(const std::string& key, double value) {
+        metrics.emplace_back(key, value);
+        return *this;
+    }
+
+    /// @brief adds the count, mean, percentiles and maximum of a set of samples (in nanoseconds) to the report
+    Report& samples(const std::string& key, std::vector<double> values) {
+        if (values.empty()) {
+            return metric(key + "_count", 0);
+        }
+
+        std::sort(values.begin(), values.end());
+        double total = 0;
+        for (const auto& v : values) {
+            total += v;
+        }
+
+        metric(key + "_count", values.size());
+        metric(key + "_mean_ns", total / values.size());
+        metric(key + "_p50_ns", values[values.size() / 2]);
+        metric(key + "_p99_ns", values[(values.size() * 99) / 100]);
+        metric(key + "_max_ns", values.back());
+        return *this;
+    }
+
+    /// @brief prints this report as a single line of JSON to standard out
+    void print() const {
+        std::ostringstream out;
+        out << std::setprecision(12) << "{\"benchmark\": \"" << name << "\"";
+        for (const auto& p : parameters) {
+            out << ", \"" << p.first << "\": " << p.second;
+        }
+        for (const auto& m : metrics) {
+            out << ", \"" << m.first << "\": " << m.second;
+        }
+        out << "}";
+        std::cout << out.str() << std::endl;
+    }
+
+private:
+    std::string name;
+    std::vector<std::pair<std::string, double>> parameters;
+    std::vector<std::pair<std::string, double>> metrics;
+};
+
+/// @brief the number of nanoseconds between two times
+inline double nanoseconds(const NUClear::clock::time_point& start, const NUClear::clock::time_point& end) {
+    return std::chrono::duration_cast<std::chrono::duration<double, std::nano>>(end - start).count();
+}
+
+/// @brief the benchmarks that have been registered, in the order they were registered
+inline std::vector<std::pair<std::string, std::function<void()>>>& registry() {
+    static std::vector<std::pair<std::string, std::function<void()>>> benchmarks;
+    return benchmarks;
+}
+
+/// @brief registers a benchmark when it is constructed
+struct Registration {
+    Registration(const std::string& name, std::function<void()>&& function) {
+        registry().emplace_back(name, std::move(function));
+    }
+};
+
+}  // namespace benchmark
+
+/// @brief declares a benchmark function and registers it so it is run by the benchmark executable
+#define NUCLEAR_BENCHMARK(name)                                                    \
+    static void name();                                                            \
+    static benchmark::Registration name##_registration(#name, &name); /* NOLINT */ \
+    static void name()
+
+#endif  // NUCLEAR_BENCHMARKS_BENCHMARK_HPP
@@ -0,0 +1,121 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+namespace {
+
+constexpr int task_count = 100000;
+
+struct Start {};
+struct SyncWork {};
+struct SingleWork {};
+struct Done {};
+
+std::atomic<int> finished(0);
+std::atomic<int> single_ran(0);
+NUClear::clock::time_point start;
+NUClear::clock::time_point end;
+
+// Measures how quickly tasks in a single Sync group run when every thread is trying to run them
+class SyncReactor : public NUClear::Reactor {
+public:
+    SyncReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<SyncWork>, Sync<SyncReactor>>().then([this] {
+            if (++finished == task_count) {
+                end = NUClear::clock::now();
+                powerplant.shutdown();
+            }
+        });
+
+        on<Trigger<Start>>().then([this] {
+            start = NUClear::clock::now();
+            for (int i = 0; i < task_count; ++i) {
+                emit(std::make_unique<SyncWork>());
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Start>()); });
+    }
+};
+
+// Measures the cost of emitting to a Single reaction that is almost always already running
+class SingleReactor : public NUClear::Reactor {
+public:
+    SingleReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<SingleWork>, Single>().then([this] { ++single_ran; });
+
+        on<Trigger<Done>>().then([this] {
+            end = NUClear::clock::now();
+            powerplant.shutdown();
+        });
+
+        on<Trigger<Start>>().then([this] {
+            start = NUClear::clock::now();
+            for (int i = 0; i < task_count; ++i) {
+                emit(std::make_unique<SingleWork>());
+            }
+            emit(std::make_unique<Done>());
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Start>()); });
+    }
+};
+
+template <typename TestReactor>
+double run(size_t thread_count) {
+
+    finished   = 0;
+    single_ran = 0;
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = thread_count;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    return benchmark::nanoseconds(start, end) / 1e9;
+}
+}  // namespace
+
+NUCLEAR_BENCHMARK(sync_contention) {
+    for (size_t threads : {1, 2, 4, 8}) {
+        double seconds = run<SyncReactor>(threads);
+        benchmark::Report("sync_contention")
+            .parameter("threads", threads)
+            .metric("tasks", task_count)
+            .metric("seconds", seconds)
+            .metric("tasks_per_second", task_count / seconds)
+            .print();
+    }
+}
+
+NUCLEAR_BENCHMARK(single_contention) {
+    for (size_t threads : {1, 2, 4, 8}) {
+        double seconds = run<SingleReactor>(threads);
+        benchmark::Report("single_contention")
+            .parameter("threads", threads)
+            .metric("emits", task_count)
+            .metric("ran", single_ran)
+            .metric("seconds", seconds)
+            .metric("emits_per_second", task_count / seconds)
+            .print();
+    }
+}
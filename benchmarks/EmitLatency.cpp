@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+namespace {
+
+constexpr int iterations = 10000;
+
+struct Ping {
+    NUClear::clock::time_point sent;
+};
+
+std::vector<double> latencies;
+
+// Measures the time from a LOCAL emit until the reaction starts running in the thread pool
+class LocalReactor : public NUClear::Reactor {
+public:
+    LocalReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Ping>>().then([this](const Ping& ping) {
+            latencies.push_back(benchmark::nanoseconds(ping.sent, NUClear::clock::now()));
+
+            // Each ping is only sent once the last one arrived so we measure latency rather than throughput
+            if (latencies.size() < iterations) {
+                emit(std::make_unique<Ping>(Ping{NUClear::clock::now()}));
+            }
+            else {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Ping>(Ping{NUClear::clock::now()})); });
+    }
+};
+
+// Measures the time from a DIRECT emit until the reaction starts running on the emitting thread
+class DirectReactor : public NUClear::Reactor {
+public:
+    DirectReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Ping>>().then([this](const Ping& ping) {
+            latencies.push_back(benchmark::nanoseconds(ping.sent, NUClear::clock::now()));
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < iterations; ++i) {
+                emit<Scope::DIRECT>(std::make_unique<Ping>(Ping{NUClear::clock::now()}));
+            }
+            powerplant.shutdown();
+        });
+    }
+};
+
+template <typename TestReactor>
+void run(const std::string& name, size_t thread_count) {
+
+    latencies.clear();
+    latencies.reserve(iterations);
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = thread_count;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // The first local ping waits for the thread pool to start so it is not counted
+    if (!latencies.empty()) {
+        latencies.erase(latencies.begin());
+    }
+
+    benchmark::Report(name).parameter("threads", thread_count).samples("latency", latencies).print();
+}
+}  // namespace
+
+NUCLEAR_BENCHMARK(emit_latency_local) {
+    for (size_t threads : {1, 2, 4}) {
+        run<LocalReactor>("emit_latency_local", threads);
+    }
+}
+
+NUCLEAR_BENCHMARK(emit_latency_direct) {
+    run<DirectReactor>("emit_latency_direct", 1);
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+namespace {
+
+constexpr int ticks = 1000;
+
+std::vector<NUClear::clock::time_point> times;
+
+// Measures how far each tick of a 1ms Every is from where it should be
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Every<1, std::chrono::milliseconds>>().then([this] {
+            times.push_back(NUClear::clock::now());
+
+            if (times.size() == ticks) {
+                powerplant.shutdown();
+            }
+        });
+    }
+};
+}  // namespace
+
+NUCLEAR_BENCHMARK(every_jitter) {
+
+    times.clear();
+    times.reserve(ticks);
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    // Jitter is how far each period was from the 1ms it should have been
+    std::vector<double> jitter;
+    for (size_t i = 1; i < times.size(); ++i) {
+        jitter.push_back(std::abs(benchmark::nanoseconds(times[i - 1], times[i]) - 1e6));
+    }
+
+    benchmark::Report("every_jitter").parameter("period_ns", 1e6).samples("jitter", jitter).print();
+}
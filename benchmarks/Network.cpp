@@ -0,0 +1,168 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+// Forking a second process to send from is only supported on POSIX systems
+#ifndef _WIN32
+
+#include <arpa/inet.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/wait.h>
+#include <unistd.h>
+
+namespace {
+
+constexpr int message_count = 10000;
+constexpr int payload_size  = 64;
+constexpr uint16_t port     = 7448;
+
+const std::string address("239.226.152.162");
+const std::string sender_name("benchmark_sender");
+const std::string receiver_name("benchmark_receiver");
+const std::string done("done");
+
+using NUClear::message::NetworkConfiguration;
+using NUClear::message::NetworkJoin;
+using NUClear::message::NetworkLeave;
+
+// The network only processes (and so announces itself) once a packet arrives, so poke the group with a
+// byte that is not a valid NUClear packet (an empty datagram would never be read off the socket)
+void wake_network() {
+    int fd = ::socket(AF_INET, SOCK_DGRAM, IPPROTO_UDP);
+    if (fd < 0) {
+        return;
+    }
+
+    sockaddr_in target{};
+    target.sin_family = AF_INET;
+    target.sin_port   = htons(port);
+    ::inet_pton(AF_INET, address.c_str(), &target.sin_addr);
+
+    const char poke = 0;
+    ::sendto(fd, &poke, sizeof(poke), 0, reinterpret_cast<sockaddr*>(&target), sizeof(target));
+    ::close(fd);
+}
+
+// Sends a burst of unreliable messages to the receiver once it joins the network, then waits for it to leave
+class Sender : public NUClear::Reactor {
+public:
+    Sender(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<NetworkJoin>, Sync<Sender>>().then([this](const NetworkJoin& join) {
+            if (join.name == receiver_name) {
+                for (int i = 0; i < message_count; ++i) {
+                    emit<Scope::NETWORK>(std::make_unique<std::string>(payload_size, 'x'), receiver_name);
+                }
+                emit<Scope::NETWORK>(std::make_unique<std::string>(done), receiver_name, true);
+            }
+        });
+
+        on<Trigger<NetworkLeave>>().then([this](const NetworkLeave& leave) {
+            if (leave.name == receiver_name) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Every<30, std::chrono::seconds>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            emit<Scope::DIRECT>(std::make_unique<NetworkConfiguration>(sender_name, address, port));
+            wake_network();
+        });
+    }
+};
+
+int received = 0;
+bool finished = false;
+NUClear::clock::time_point start;
+NUClear::clock::time_point end;
+
+// Counts the messages from the sender and reports how quickly they arrived
+class Receiver : public NUClear::Reactor {
+public:
+    Receiver(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Network<std::string>, Sync<Receiver>>().then(
+            [this](const NUClear::dsl::word::NetworkSource& source, const std::string& s) {
+                if (source.name != sender_name) {
+                    return;
+                }
+
+                if (s == done) {
+                    end      = NUClear::clock::now();
+                    finished = true;
+                    powerplant.shutdown();
+                }
+                else if (received++ == 0) {
+                    start = NUClear::clock::now();
+                }
+            });
+
+        on<Every<20, std::chrono::seconds>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            emit<Scope::DIRECT>(std::make_unique<NetworkConfiguration>(receiver_name, address, port));
+            wake_network();
+        });
+    }
+};
+
+template <typename TestReactor>
+void run() {
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+}
+}  // namespace
+
+NUCLEAR_BENCHMARK(network_loopback) {
+
+    received = 0;
+    finished = false;
+
+    // A process can only have one PowerPlant so the sender runs in a child process
+    pid_t child = fork();
+    if (child == 0) {
+        run<Sender>();
+        _exit(0);
+    }
+    else if (child < 0) {
+        benchmark::Report("network_loopback").metric("error", 1).print();
+        return;
+    }
+
+    run<Receiver>();
+    waitpid(child, nullptr, 0);
+
+    double seconds = benchmark::nanoseconds(start, end) / 1e9;
+    benchmark::Report("network_loopback")
+        .parameter("messages", message_count)
+        .parameter("payload_bytes", payload_size)
+        .metric("error", finished ? 0 : 1)
+        .metric("received", received)
+        .metric("delivered", double(received) / message_count)
+        .metric("seconds", seconds)
+        .metric("messages_per_second", finished && seconds > 0 ? received / seconds : 0)
+        .print();
+}
+
+#endif  // _WIN32
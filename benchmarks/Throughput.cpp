@@ -0,0 +1,99 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+namespace {
+
+constexpr int task_count = 100000;
+
+struct Start {};
+struct Work {};
+
+bool batched = false;
+std::atomic<int> finished(0);
+NUClear::clock::time_point start;
+NUClear::clock::time_point end;
+
+// Measures how many small tasks per second the thread pool can run when they are emitted all at once
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Work>>().then([this] {
+            if (++finished == task_count) {
+                end = NUClear::clock::now();
+                powerplant.shutdown();
+            }
+        });
+
+        on<Trigger<Start>>().then([this] {
+            start = NUClear::clock::now();
+
+            if (batched) {
+                std::vector<std::unique_ptr<Work>> work;
+                work.reserve(task_count);
+                for (int i = 0; i < task_count; ++i) {
+                    work.push_back(std::make_unique<Work>());
+                }
+                emit(std::move(work));
+            }
+            else {
+                for (int i = 0; i < task_count; ++i) {
+                    emit(std::make_unique<Work>());
+                }
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Start>()); });
+    }
+};
+
+void run(const std::string& name, size_t thread_count, bool work_stealing) {
+
+    finished = 0;
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count  = thread_count;
+    config.work_stealing = work_stealing;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    double seconds = benchmark::nanoseconds(start, end) / 1e9;
+    benchmark::Report(name)
+        .parameter("threads", thread_count)
+        .parameter("work_stealing", work_stealing)
+        .parameter("batched", batched)
+        .metric("tasks", task_count)
+        .metric("seconds", seconds)
+        .metric("tasks_per_second", task_count / seconds)
+        .print();
+}
+}  // namespace
+
+NUCLEAR_BENCHMARK(task_throughput) {
+    for (bool batch : {false, true}) {
+        batched = batch;
+        for (bool work_stealing : {false, true}) {
+            for (size_t threads : {1, 2, 4, 8}) {
+                run("task_throughput", threads, work_stealing);
+            }
+        }
+    }
+}
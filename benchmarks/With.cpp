@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include "Benchmark.hpp"
+
+namespace {
+
+constexpr int iterations = 100000;
+
+template <int N>
+struct Data {
+    int value;
+};
+
+struct Plain {};
+struct Joined {};
+
+NUClear::clock::time_point start;
+NUClear::clock::time_point middle;
+NUClear::clock::time_point end;
+int ran = 0;
+
+// Compares direct emits to a reaction with no extra data against one that also collects three With<> types
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Plain>>().then([this] { ++ran; });
+
+        on<Trigger<Joined>, With<Data<0>, Data<1>, Data<2>>>().then(
+            [this](const Data<0>&, const Data<1>&, const Data<2>&) { ++ran; });
+
+        on<Startup>().then([this] {
+            emit<Scope::DIRECT>(std::make_unique<Data<0>>(Data<0>{0}));
+            emit<Scope::DIRECT>(std::make_unique<Data<1>>(Data<1>{1}));
+            emit<Scope::DIRECT>(std::make_unique<Data<2>>(Data<2>{2}));
+
+            start = NUClear::clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                emit<Scope::DIRECT>(std::make_unique<Plain>());
+            }
+            middle = NUClear::clock::now();
+            for (int i = 0; i < iterations; ++i) {
+                emit<Scope::DIRECT>(std::make_unique<Joined>());
+            }
+            end = NUClear::clock::now();
+
+            powerplant.shutdown();
+        });
+    }
+};
+}  // namespace
+
+NUCLEAR_BENCHMARK(with_lookup) {
+
+    ran = 0;
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+    plant.start();
+
+    double plain  = benchmark::nanoseconds(start, middle) / iterations;
+    double joined = benchmark::nanoseconds(middle, end) / iterations;
+
+    benchmark::Report("with_lookup")
+        .parameter("with_types", 3)
+        .metric("ran", ran)
+        .metric("trigger_ns_per_emit", plain)
+        .metric("trigger_with_ns_per_emit", joined)
+        .metric("with_overhead_ns", joined - plain)
+        .print();
+}
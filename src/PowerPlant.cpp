@@ -17,6 +17,7 @@
  */
 #include "nuclear_bits/PowerPlant.hpp"
 #include "nuclear_bits/threading/ThreadPoolTask.hpp"
+#include "nuclear_bits/util/update_current_thread_priority.hpp"
 
 #include "nuclear_bits/extension/ChronoController.hpp"
 #include "nuclear_bits/extension/IOController.hpp"
@@ -26,7 +27,13 @@ namespace NUClear {
 
 PowerPlant* PowerPlant::powerplant = nullptr;  // NOLINT
 
-PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]) : configuration(config) {
+PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[])
+    : configuration(config)
+    , scheduler(config.thread_count,
+                config.work_stealing,
+                config.idle_spin_count,
+                config.idle_yield_count,
+                config.numa_nodes) {
 
     // Stop people from making more then one powerplant
     if (powerplant != nullptr) {
@@ -36,6 +43,9 @@ PowerPlant::PowerPlant(Configuration config, int argc, const char* argv[]) : con
     // Store our static variable
     powerplant = this;
 
+    // Set if we are allowed to change the OS priority of our threads
+    util::thread_priority_enabled = config.thread_priority;
+
     // Install the Chrono reactor
     install<extension::ChronoController>();
     install<extension::IOController>();
@@ -85,9 +95,23 @@ void PowerPlant::start() {
     // Direct emit startup event
     emit<dsl::word::emit::Direct>(std::make_unique<dsl::word::Startup>());
 
-    // Start all our threads
+    // Start all our threads, pinning them to the next NUMA node or CPU in turn if we were given them
     for (size_t i = 0; i < configuration.thread_count; ++i) {
-        tasks.push_back(threading::make_thread_pool_task(*this, scheduler));
+        std::vector<int> cpus;
+        if (!configuration.numa_nodes.empty()) {
+            cpus = configuration.numa_nodes[i % configuration.numa_nodes.size()];
+        }
+        else if (!configuration.cpus.empty()) {
+            cpus = {configuration.cpus[i % configuration.cpus.size()]};
+        }
+        tasks.push_back(threading::make_thread_pool_task(*this, scheduler, cpus));
+    }
+
+    // Start the threads for our separate pools
+    for (auto& pool : pools) {
+        for (size_t i = 0; i < pool.second->thread_count; ++i) {
+            tasks.push_back(threading::make_thread_pool_task(*this, pool.second->scheduler, pool.second->cpus));
+        }
     }
 
     // Start all our tasks
@@ -116,10 +140,42 @@ void PowerPlant::submit(std::unique_ptr<threading::ReactionTask>&& task) {
     scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
 }
 
+void PowerPlant::submit(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks) {
+    scheduler.submit(std::forward<std::vector<std::unique_ptr<threading::ReactionTask>>>(tasks));
+}
+
 void PowerPlant::submit_main(std::unique_ptr<threading::ReactionTask>&& task) {
     main_thread_scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
 }
 
+void PowerPlant::add_pool(const std::type_index& pool, size_t thread_count, const std::vector<int>& cpus) {
+
+    std::lock_guard<std::mutex> lock(pool_mutex);
+
+    if (pools.find(pool) == pools.end()) {
+        if (is_running) {
+            throw std::runtime_error("Unable to add a thread pool as the PowerPlant has already started");
+        }
+        pools.insert(std::make_pair(pool, std::make_unique<ThreadPool>(thread_count, cpus)));
+    }
+}
+
+void PowerPlant::submit_pool(const std::type_index& pool, std::unique_ptr<threading::ReactionTask>&& task) {
+
+    // Pools can only be added before we start so nothing changes the map while we read it
+    pools.at(pool)->scheduler.submit(std::forward<std::unique_ptr<threading::ReactionTask>>(task));
+}
+
+bool PowerPlant::in_pool(const std::type_index& pool) {
+
+    // Pools can only be added before we start so nothing changes the map while we read it
+    return pools.at(pool)->scheduler.is_current_thread();
+}
+
+bool PowerPlant::in_default_pool() const {
+    return scheduler.is_current_thread();
+}
+
 void PowerPlant::shutdown() {
 
     // Emit our shutdown event
@@ -133,6 +189,11 @@ void PowerPlant::shutdown() {
     // Shutdown the main threads scheduler
     main_thread_scheduler.shutdown();
 
+    // Shutdown our separate pools
+    for (auto& pool : pools) {
+        pool.second->scheduler.shutdown();
+    }
+
     // Bye bye powerplant
     powerplant = nullptr;
 }
@@ -19,6 +19,7 @@
 #include "nuclear_bits/extension/ChronoController.hpp"
 
 #include <algorithm>
+#include <thread>
 
 #include "nuclear_bits/dsl/word/Every.hpp"
 
@@ -28,7 +29,12 @@ namespace extension {
     using NUClear::dsl::operation::ChronoTask;
 
     ChronoController::ChronoController(std::unique_ptr<NUClear::Environment> environment)
-        : Reactor(std::move(environment)), wait_offset(std::chrono::milliseconds(0)) {
+        : Reactor(std::move(environment))
+        , wait_offset(std::chrono::milliseconds(0))
+        , max_wait_offset(std::thread::hardware_concurrency() > 1 ? powerplant.configuration.timer_spin
+                                                                  : NUClear::clock::duration(0))
+        , wake_latency(std::chrono::milliseconds(0))
+        , slack(powerplant.configuration.timer_slack) {
 
         on<Trigger<ChronoTask>>().then("Add Chrono task", [this](std::shared_ptr<const ChronoTask> task) {
             // Lock the mutex while we're doing stuff
@@ -37,6 +43,7 @@ namespace extension {
 
                 // Add our new task to the heap
                 tasks.push_back(*task);
+                std::push_heap(tasks.begin(), tasks.end(), std::greater<>());
             }
 
             // Poke the system
@@ -49,13 +56,12 @@ namespace extension {
                 {
                     std::lock_guard<std::mutex> lock(mutex);
 
-                    // Find the task
-                    auto it = std::find_if(
-                        tasks.begin(), tasks.end(), [&](const ChronoTask& task) { return task.id == unbind.id; });
+                    // Mark the task as cancelled, it will be dropped rather than run when it gets to the front
+                    cancelled.insert(unbind.id);
 
-                    // Remove if if it exists
-                    if (it != tasks.end()) {
-                        tasks.erase(it);
+                    // Once a large part of the heap is cancelled clean it up so it doesn't grow forever
+                    if (cancelled.size() * 2 > tasks.size()) {
+                        compact();
                     }
                 }
 
@@ -70,48 +76,126 @@ namespace extension {
             // Acquire the mutex lock so we can wait on it
             std::unique_lock<std::mutex> lock(mutex);
 
+            // Drop any unbound tasks that are at the front so we don't wait for them
+            while (!tasks.empty() && cancelled.count(tasks.front().id) > 0) {
+                std::pop_heap(tasks.begin(), tasks.end(), std::greater<>());
+                tasks.pop_back();
+            }
+
             // If we have tasks to do
             if (!tasks.empty()) {
 
-                // Make the list into a heap so we can remove the soonest ones
-                std::make_heap(tasks.begin(), tasks.end(), std::greater<>());
+                // Waiting out our slack lets any tasks that become due in that time share this wake up
+                NUClear::clock::time_point target = tasks.front().time + slack;
 
                 // If we are within the wait offset of the time, spinlock until we get there for greater accuracy
-                if (NUClear::clock::now() + wait_offset > tasks.front().time) {
+                if (NUClear::clock::now() + wait_offset > target) {
 
-                    // Spinlock!
-                    while (NUClear::clock::now() < tasks.front().time) {
+                    // Spin without the lock so new tasks can be added while we do
+                    lock.unlock();
+                    while (NUClear::clock::now() < target) {
                     }
+                    lock.lock();
 
-                    NUClear::clock::time_point now = NUClear::clock::now();
-
-                    // Move back from the end poping the heap
-                    for (auto end = tasks.end(); end != tasks.begin() && tasks.front().time < now;) {
-                        // Run our task and if it returns false remove it
-                        bool renew = tasks.front()();
-
-                        // Move this to the back of the list
-                        std::pop_heap(tasks.begin(), end, std::greater<>());
-
-                        if (!renew) {
-                            end = tasks.erase(--end);
-                        }
-                        else {
-                            --end;
-                        }
-                    }
+                    run_due_tasks();
                 }
-                // Otherwise we wait for the next event using a wait_for (with a small offset for greater accuracy)
+                // Otherwise we wait for the next event using a wait_until (waking early by the offset so we can spin)
                 // Either that or until we get interrupted with a new event
                 else {
-                    wait.wait_until(lock, tasks.front().time - wait_offset);
+                    NUClear::clock::time_point wake = target - wait_offset;
+                    if (wait.wait_until(lock, wake) == std::cv_status::timeout) {
+                        calibrate(NUClear::clock::now() - wake);
+                    }
                 }
             }
             // Otherwise we wait for something to happen
             else {
                 wait.wait(lock);
             }
+
+            // Report our timing statistics about once a second if we have been running tasks
+            NUClear::clock::time_point now = NUClear::clock::now();
+            if (stats.tasks > 0 && now - stats.last_report > std::chrono::seconds(1)) {
+                auto msg = std::make_unique<message::ChronoStatistics>(stats.tasks,
+                                                                       stats.total_lateness / stats.tasks,
+                                                                       stats.max_lateness,
+                                                                       wake_latency,
+                                                                       wait_offset);
+                stats.tasks          = 0;
+                stats.total_lateness = NUClear::clock::duration(0);
+                stats.max_lateness   = NUClear::clock::duration(0);
+                stats.last_report    = now;
+
+                lock.unlock();
+                emit(msg);
+            }
         });
     }
+
+    void ChronoController::run_due_tasks() {
+
+        NUClear::clock::time_point now = NUClear::clock::now();
+
+        // Collect the reaction tasks that are made so they all go to the thread pool together
+        dsl::operation::ChronoBatch batch;
+        dsl::store::ThreadStore<dsl::operation::ChronoBatch>::value = &batch;
+
+        // Pop every task that is due off the heap, running it and putting it back if it renews
+        while (!tasks.empty() && tasks.front().time <= now) {
+
+            // Move the soonest task to the back of the list
+            std::pop_heap(tasks.begin(), tasks.end(), std::greater<>());
+            ChronoTask& task = tasks.back();
+
+            // Drop it if it was unbound
+            if (cancelled.count(task.id) > 0) {
+                tasks.pop_back();
+                continue;
+            }
+
+            // Record how late we are running it
+            NUClear::clock::duration lateness = now - task.time;
+            ++stats.tasks;
+            stats.total_lateness += lateness;
+            stats.max_lateness = std::max(stats.max_lateness, lateness);
+
+            // Run our task and if it renews put it back in the heap
+            if (task()) {
+                std::push_heap(tasks.begin(), tasks.end(), std::greater<>());
+            }
+            else {
+                tasks.pop_back();
+            }
+        }
+
+        dsl::store::ThreadStore<dsl::operation::ChronoBatch>::value = nullptr;
+
+        // Give everything that was due together to the thread pool at once
+        if (!batch.empty()) {
+            powerplant.submit(std::move(batch));
+        }
+    }
+
+    void ChronoController::calibrate(const NUClear::clock::duration& latency) {
+
+        // Keep a running average of how late we wake up so a single slow wake doesn't throw it out
+        wake_latency = (wake_latency * 7 + latency) / 8;
+
+        // Spin for twice our usual latency so most of our wake ups are early enough, but never for too long
+        wait_offset = std::min(max_wait_offset, std::max(NUClear::clock::duration(0), wake_latency * 2));
+    }
+
+    void ChronoController::compact() {
+
+        // Remove all the cancelled tasks and rebuild the heap from what is left
+        tasks.erase(std::remove_if(tasks.begin(),
+                                   tasks.end(),
+                                   [this](const ChronoTask& task) { return cancelled.count(task.id) > 0; }),
+                    tasks.end());
+        std::make_heap(tasks.begin(), tasks.end(), std::greater<>());
+
+        // Nothing that is cancelled is left in the heap so we can forget them
+        cancelled.clear();
+    }
 }  // namespace extension
 }  // namespace NUClear
@@ -0,0 +1,225 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+// Only linux has epoll
+#ifdef __linux__
+
+#include "nuclear_bits/extension/IOController.hpp"
+
+#include <sys/eventfd.h>
+
+#include <algorithm>
+#include <array>
+#include <mutex>
+#include <system_error>
+#include "nuclear_bits/dsl/word/IO.hpp"
+
+namespace NUClear {
+namespace extension {
+
+    IOController::IOController(std::unique_ptr<NUClear::Environment> environment)
+        : Reactor(std::move(environment)), epoll_fd(epoll_create1(EPOLL_CLOEXEC)), notify_fd(eventfd(0, EFD_CLOEXEC)) {
+
+        if (epoll_fd < 0) {
+            throw std::system_error(network_errno, std::system_category(), "We were unable to make the epoll for IO");
+        }
+        if (notify_fd < 0) {
+            throw std::system_error(
+                network_errno, std::system_category(), "We were unable to make the notification eventfd for IO");
+        }
+
+        // Watch our notification eventfd, it has no watch so its data is null
+        epoll_event notify{};
+        notify.events   = EPOLLIN;
+        notify.data.ptr = nullptr;
+        if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, notify_fd, &notify) < 0) {
+            throw std::system_error(
+                network_errno, std::system_category(), "We were unable to watch the notification eventfd for IO");
+        }
+
+        on<Trigger<dsl::word::IOConfiguration>>().then(
+            "Configure IO Reaction", [this](const dsl::word::IOConfiguration& config) {
+
+                // Lock our mutex to avoid concurrent modification
+                std::lock_guard<std::mutex> lock(reaction_mutex);
+
+                // Find the watch for this fd, or make a new one
+                auto& watch = watches[config.fd];
+                if (!watch) {
+                    watch = std::make_shared<Watch>(config.fd);
+                }
+
+                watch->tasks.emplace_back(static_cast<short>(config.events), config.reaction);
+                reaction_fds[config.reaction->id] = config.fd;
+
+                // Tell epoll what we are now interested in
+                update(watch);
+            });
+
+        on<Trigger<dsl::operation::Unbind<IO>>>().then(
+            "Unbind IO Reaction", [this](const dsl::operation::Unbind<IO>& unbind) {
+
+                // Lock our mutex to avoid concurrent modification
+                std::lock_guard<std::mutex> lock(reaction_mutex);
+
+                // Find which fd this reaction was watching
+                auto fd = reaction_fds.find(unbind.id);
+                if (fd == reaction_fds.end()) {
+                    return;
+                }
+
+                auto watch = watches.find(fd->second);
+                reaction_fds.erase(fd);
+                if (watch == watches.end()) {
+                    return;
+                }
+
+                // Remove the reaction from the watch
+                auto& tasks = watch->second->tasks;
+                tasks.erase(std::remove_if(tasks.begin(),
+                                           tasks.end(),
+                                           [&unbind](const Task& t) { return t.reaction->id == unbind.id; }),
+                            tasks.end());
+
+                // Tell epoll what we are now interested in
+                update(watch->second);
+            });
+
+        on<Shutdown>().then("Shutdown IO Controller", [this] {
+
+            // Set shutdown to true so it won't try to wait again
+            shutdown = true;
+
+            // Wake up the epoll_wait
+            uint64_t val = 1;
+            if (write(notify_fd, &val, sizeof(val)) < 0) {
+                throw std::system_error(network_errno,
+                                        std::system_category(),
+                                        "There was an error while writing to the notification eventfd");
+            }
+        });
+
+        on<Always>().then("IO Controller", [this] {
+
+            // To make sure we don't get caught in a weird loop
+            // shutdown keeps us out here
+            if (!shutdown) {
+
+                // Wait for events on our file descriptors
+                std::array<epoll_event, 128> events;
+                int result = epoll_wait(epoll_fd, events.data(), static_cast<int>(events.size()), -1);
+
+                // Check if we had an error on our wait (being interrupted by a signal is fine)
+                if (result < 0) {
+                    if (errno != EINTR) {
+                        throw std::system_error(network_errno,
+                                                std::system_category(),
+                                                "There was an IO error while attempting to wait for the file descriptors");
+                    }
+                    return;
+                }
+
+                // Lock so the watches can't change while we use them
+                std::lock_guard<std::mutex> lock(reaction_mutex);
+
+                for (int i = 0; i < result; ++i) {
+                    auto* watch = static_cast<Watch*>(events[i].data.ptr);
+
+                    // It's our notification handle, read it to clear it
+                    if (watch == nullptr) {
+                        uint64_t val;
+                        if (read(notify_fd, &val, sizeof(val)) < 0) {
+                            throw std::system_error(network_errno,
+                                                    std::system_category(),
+                                                    "There was an error reading our notification eventfd?");
+                        }
+                        continue;
+                    }
+
+                    // Tell each of the reactions that are interested in these events
+                    for (auto& task : watch->tasks) {
+                        if ((task.events & events[i].events) != 0) {
+
+                            // Make our event to pass through
+                            IO::Event e{};
+                            e.fd     = watch->fd;
+                            e.events = static_cast<int>(events[i].events);
+
+                            // Store the event in our thread local cache
+                            IO::ThreadEventStore::value = &e;
+
+                            // Submit the task (which should run the get)
+                            try {
+                                auto t = task.reaction->get_task();
+                                if (t) {
+                                    powerplant.submit(std::move(t));
+                                }
+                            }
+                            catch (...) {
+                            }
+
+                            // Reset our value
+                            IO::ThreadEventStore::value = nullptr;
+                        }
+                    }
+                }
+
+                // Nothing we waited on can refer to these anymore
+                retired.clear();
+            }
+        });
+    }
+
+    void IOController::update(std::shared_ptr<Watch> watch) {
+
+        // Work out everything that the reactions are interested in
+        uint32_t events = 0;
+        for (const auto& task : watch->tasks) {
+            events |= static_cast<uint16_t>(task.events);
+        }
+
+        epoll_event event{};
+        event.events   = events;
+        event.data.ptr = watch.get();
+
+        // Nothing is watching anymore so stop watching, keeping the watch alive until epoll_wait can't return it
+        if (watch->tasks.empty()) {
+            // The fd may have already been closed, which removes it from epoll anyway
+            epoll_ctl(epoll_fd, EPOLL_CTL_DEL, watch->fd, &event);
+            retired.push_back(watch);
+            watches.erase(watch->fd);
+        }
+        // Always tell epoll, the fd could have been closed (which removes it from epoll) and the number reused
+        else if (epoll_ctl(epoll_fd, EPOLL_CTL_MOD, watch->fd, &event) < 0) {
+            if (errno == ENOENT) {
+                if (epoll_ctl(epoll_fd, EPOLL_CTL_ADD, watch->fd, &event) < 0) {
+                    throw std::system_error(
+                        network_errno, std::system_category(), "We were unable to watch an fd for IO");
+                }
+            }
+            // If the fd has been closed there is nothing for epoll to watch
+            else if (errno != EBADF) {
+                throw std::system_error(
+                    network_errno, std::system_category(), "We were unable to update an fd we are watching for IO");
+            }
+        }
+    }
+}  // namespace extension
+}  // namespace NUClear
+
+#endif
@@ -16,8 +16,8 @@
  * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
  */
 
-// Disable this file on windows
-#ifndef _WIN32
+// Disable this file on windows and linux (which uses epoll)
+#if !defined(_WIN32) && !defined(__linux__)
 
 #include "nuclear_bits/extension/IOController.hpp"
 
@@ -32,11 +32,14 @@
 #include <vector>
 
 // Utilities
+#include "nuclear_bits/dsl/trait/allocator.hpp"
 #include "nuclear_bits/util/FunctionFusion.hpp"
+#include "nuclear_bits/util/RecyclingAllocator.hpp"
 #include "nuclear_bits/util/demangle.hpp"
 #include "nuclear_bits/util/unpack.hpp"
 
 #include "nuclear_bits/LogLevel.hpp"
+#include "nuclear_bits/clock.hpp"
 #include "nuclear_bits/message/LogMessage.hpp"
 #include "nuclear_bits/threading/TaskScheduler.hpp"
 
@@ -62,15 +65,56 @@ public:
      * @brief This class holds the configuration for a PowerPlant.
      *
      * @details
-     *  It configures the number of threads that will be in the PowerPlants thread pool
+     *  It configures the number of threads that will be in the PowerPlants thread pool and how tasks are distributed
+     *  amongst them
      */
     struct Configuration {
         /// @brief default to the amount of hardware concurrency (or 2) threads
         Configuration()
-            : thread_count(std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency()) {}
+            : thread_count(std::thread::hardware_concurrency() == 0 ? 2 : std::thread::hardware_concurrency())
+            , work_stealing(false)
+            , idle_spin_count(1000)
+            , idle_yield_count(10)
+            , cpus()
+            , numa_nodes()
+            , thread_priority(true)
+            , timer_spin(std::chrono::microseconds(150))
+            , timer_slack(0) {}
 
         /// @brief The number of threads the system will use
         size_t thread_count;
+
+        /// @brief If each pool thread should keep its own task queue and steal tasks from the others when idle
+        bool work_stealing;
+
+        /// @brief How many times an idle pool thread checks for new tasks before it starts yielding (single CPU
+        /// systems never spin)
+        size_t idle_spin_count;
+
+        /// @brief How many times an idle pool thread yields to the OS before it goes to sleep until woken
+        size_t idle_yield_count;
+
+        /// @brief The CPUs to pin the pool threads to, each thread is pinned to the next CPU in the list. If this is
+        /// empty (and there are no numa_nodes) the threads are not pinned.
+        std::vector<int> cpus;
+
+        /// @brief The CPUs that are in each NUMA node. If this is given each pool thread is pinned to the CPUs of the
+        /// next node in turn, and threads prefer to take work from other threads on their own node.
+        std::vector<std::vector<int>> numa_nodes;
+
+        /// @brief If the OS scheduling priority of threads should follow the priority of the tasks they run. If this
+        /// is false NUClear never changes the OS scheduling of its threads.
+        bool thread_priority;
+
+        /// @brief The longest the chrono controller may busy wait before a timed task is due, to make up for how late
+        /// its thread wakes up. It only spins for as long as it measures it needs to, up to this bound. Set this to
+        /// zero to never spin. Single CPU systems never spin.
+        clock::duration timer_spin;
+
+        /// @brief How late a timed task (such as an Every or a delayed emit) may be run so that tasks due soon after
+        /// it can share its wake up. Tasks are never run early. All the reactions that are due together are given to
+        /// the thread pool in one batch.
+        clock::duration timer_slack;
     };
 
     /// @brief Holds the configuration information for this PowerPlant (such as number of pool threads)
@@ -146,6 +190,13 @@ public:
      */
     void submit(std::unique_ptr<threading::ReactionTask>&& task);
 
+    /**
+     * @brief Submits a batch of new tasks to the ThreadPool to be queued and then executed.
+     *
+     * @param tasks The Reaction tasks to be executed in the thread pool, in the order they should be queued
+     */
+    void submit(std::vector<std::unique_ptr<threading::ReactionTask>>&& tasks);
+
     /**
      * @brief Submits a new task to the main threads thread pool to be queued and then executed.
      *
@@ -153,12 +204,49 @@ public:
      */
     void submit_main(std::unique_ptr<threading::ReactionTask>&& task);
 
+    /**
+     * @brief Creates a separate thread pool that reactions can be run in using the Pool DSL word.
+     *
+     * @details
+     *  If the pool already exists this does nothing. Pools must be added before the PowerPlant is started.
+     *
+     * @param pool          the type that identifies the pool
+     * @param thread_count  the number of threads in the pool
+     * @param cpus          the CPUs to pin the threads of this pool to, or empty to not pin them
+     */
+    void add_pool(const std::type_index& pool, size_t thread_count, const std::vector<int>& cpus);
+
+    /**
+     * @brief Submits a new task to a separate thread pool to be queued and then executed.
+     *
+     * @param pool The type that identifies the pool
+     * @param task The Reaction task to be executed in the thread pool
+     */
+    void submit_pool(const std::type_index& pool, std::unique_ptr<threading::ReactionTask>&& task);
+
+    /**
+     * @brief Checks if the calling thread is one of the threads in a separate thread pool.
+     *
+     * @param pool The type that identifies the pool
+     *
+     * @return true if the calling thread belongs to the pool
+     */
+    bool in_pool(const std::type_index& pool);
+
+    /**
+     * @brief Checks if the calling thread is one of the threads in the default thread pool.
+     *
+     * @return true if the calling thread belongs to the default thread pool
+     */
+    bool in_default_pool() const;
+
     /**
      * @brief Log a message through NUClear's system.
      *
      * @details
      *  Logs a message through the system so the various log handlers
-     *  can access it.
+     *  can access it. The log handlers have all run by the time this
+     *  returns.
      *
      * @tparam level     The level to log at (defaults to DEBUG)
      * @tparam Arguments The types of the arguments we are logging
@@ -214,6 +302,61 @@ public:
               typename... Arguments>
     void emit(std::unique_ptr<T>& data, Arguments&&... args);
 
+    /**
+     * @brief Makes data and emits it to the system, routing it to the other systems that use it.
+     *
+     * @details
+     *  The data is constructed in the same allocation as its shared_ptr control block, using the allocator given
+     *  by dsl::trait::allocator for its type. This saves the second allocation that emitting a unique_ptr needs.
+     *  The arguments are all passed to the constructor of T, so emit handlers that need extra arguments (such as
+     *  Delay) can not be used.
+     *
+     * @tparam T            the type of the data that we are emitting
+     * @tparam First        the first handler to use for this emit
+     * @tparam Remainder    the remaining handlers to use for this emit
+     * @tparam Arguments    the types of the arguments to construct T with
+     *
+     * @param args The arguments to construct T with
+     */
+    template <typename T, typename... Arguments>
+    void emit_make(Arguments&&... args);
+
+    template <typename T,
+              template <typename> class First,
+              template <typename> class... Remainder,
+              typename... Arguments>
+    void emit_make(Arguments&&... args);
+
+    /**
+     * @brief Emits a batch of data to the system and routes it to the other systems that use it.
+     *
+     * @details
+     *  Each element is emitted in order as if it was emitted by itself, however all of the tasks that are created
+     *  are given to the thread pool together. This is much cheaper than emitting a large number of small messages
+     *  one at a time. Only emit handlers that accept a batch (such as Local) can be used.
+     *
+     * @tparam First        the first handler to use for this emit
+     * @tparam Remainder    the remaining handlers to use for this emit
+     * @tparam T            the type of the data that we are emitting
+     * @tparam Arguments    the additional arguments that will be provided to the handlers
+     *
+     * @param data The data we are emitting
+     */
+    template <typename T>
+    void emit(std::vector<std::unique_ptr<T>>&& data);
+
+    template <template <typename> class First,
+              template <typename> class... Remainder,
+              typename T,
+              typename... Arguments>
+    void emit_shared(std::vector<std::shared_ptr<T>>&& data, Arguments&&... args);
+
+    template <template <typename> class First,
+              template <typename> class... Remainder,
+              typename T,
+              typename... Arguments>
+    void emit(std::vector<std::unique_ptr<T>>&& data, Arguments&&... args);
+
 private:
     /// @brief A list of tasks that must be run when the powerplant starts up
     std::vector<std::function<void()>> tasks;
@@ -223,6 +366,23 @@ private:
     threading::TaskScheduler scheduler;
     /// @brief Our TaskScheduler that handles distributing tasks to the main thread
     threading::TaskScheduler main_thread_scheduler;
+
+    /// @brief A separate thread pool that has been created with the Pool DSL word
+    struct ThreadPool {
+        ThreadPool(size_t thread_count, const std::vector<int>& cpus)
+            : thread_count(thread_count), cpus(cpus), scheduler(thread_count) {}
+
+        /// @brief the number of threads in this pool
+        size_t thread_count;
+        /// @brief the CPUs to pin the threads of this pool to
+        std::vector<int> cpus;
+        /// @brief the TaskScheduler that distributes tasks to this pools threads
+        threading::TaskScheduler scheduler;
+    };
+    /// @brief Our separate thread pools, these are only added before we start so they can be read without a lock
+    std::map<std::type_index, std::unique_ptr<ThreadPool>> pools;
+    /// @brief The mutex that protects adding to our separate thread pools
+    std::mutex pool_mutex;
     /// @brief Our vector of Reactors, will get destructed when this vector is
     std::vector<std::unique_ptr<NUClear::Reactor>> reactors;
     /// @brief Tasks that will be run during the startup process
@@ -245,12 +405,18 @@ void log(Arguments&&... args) {
 // Emit types
 #include "nuclear_bits/dsl/word/emit/Direct.hpp"
 #include "nuclear_bits/dsl/word/emit/Initialise.hpp"
+#include "nuclear_bits/dsl/word/emit/Inline.hpp"
 #include "nuclear_bits/dsl/word/emit/Local.hpp"
 
 // Built in smart types
+#include "nuclear_bits/message/ChronoStatistics.hpp"
 #include "nuclear_bits/message/CommandLineArguments.hpp"
 #include "nuclear_bits/message/NetworkConfiguration.hpp"
 #include "nuclear_bits/message/NetworkEvent.hpp"
+#include "nuclear_bits/message/PoolStatistics.hpp"
+
+// Pools for emitted data
+#include "nuclear_bits/util/ObjectPool.hpp"
 
 // Include all of our implementation files (which use the previously included reactor.h)
 #include "nuclear_bits/PowerPlant.ipp"
@@ -42,6 +42,13 @@ void PowerPlant::emit(std::unique_ptr<T>& data) {
     emit<dsl::word::emit::Local>(std::move(data));
 }
 
+// Default emit with no types
+template <typename T>
+void PowerPlant::emit(std::vector<std::unique_ptr<T>>&& data) {
+
+    emit<dsl::word::emit::Local>(std::forward<std::vector<std::unique_ptr<T>>>(data));
+}
+
 // Default emit with no types
 template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
 void PowerPlant::emit(std::unique_ptr<T>& data, Arguments&&... args) {
@@ -89,8 +96,52 @@ void PowerPlant::emit_shared(std::shared_ptr<T>&& ptr, Arguments&&... args) {
 template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
 void PowerPlant::emit(std::unique_ptr<T>&& data, Arguments&&... args) {
 
-    // Release our data from the pointer and wrap it in a shared_ptr
-    emit_shared<First, Remainder...>(std::shared_ptr<T>(std::move(data)), std::forward<Arguments>(args)...);
+    // Release our data from the pointer and wrap it in a shared_ptr (that gives it back to its pool if it has one)
+    emit_shared<First, Remainder...>(util::share_emitted(std::move(data)), std::forward<Arguments>(args)...);
+}
+
+template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
+void PowerPlant::emit_shared(std::vector<std::shared_ptr<T>>&& data, Arguments&&... args) {
+
+    using Functions      = std::tuple<First<T>, Remainder<T>...>;
+    using ArgumentPack   = decltype(std::forward_as_tuple(*this, data, std::forward<Arguments>(args)...));
+    using CallerArgs     = std::tuple<>;
+    using FusionFunction = util::FunctionFusion<Functions, ArgumentPack, EmitCaller, CallerArgs, 2>;
+
+    // Provide a check to make sure they are passing us the right stuff
+    static_assert(FusionFunction::value,
+                  "There was an error with the arguments for the emit function, Check that your scope and arguments "
+                  "match what you are trying to do, not all scopes can emit a batch of data.");
+
+    // Fuse our emit handlers and call the fused function
+    FusionFunction::call(*this, data, std::forward<Arguments>(args)...);
+}
+
+template <template <typename> class First, template <typename> class... Remainder, typename T, typename... Arguments>
+void PowerPlant::emit(std::vector<std::unique_ptr<T>>&& data, Arguments&&... args) {
+
+    // Release our data from the pointers and wrap them in shared_ptrs
+    std::vector<std::shared_ptr<T>> shared;
+    shared.reserve(data.size());
+    for (auto& d : data) {
+        shared.push_back(util::share_emitted(std::move(d)));
+    }
+
+    emit_shared<First, Remainder...>(std::move(shared), std::forward<Arguments>(args)...);
+}
+
+template <typename T, typename... Arguments>
+void PowerPlant::emit_make(Arguments&&... args) {
+
+    emit_make<T, dsl::word::emit::Local>(std::forward<Arguments>(args)...);
+}
+
+template <typename T, template <typename> class First, template <typename> class... Remainder, typename... Arguments>
+void PowerPlant::emit_make(Arguments&&... args) {
+
+    // Make our data and its control block together in one allocation
+    emit_shared<First, Remainder...>(
+        std::allocate_shared<T>(typename dsl::trait::allocator<T>::type(), std::forward<Arguments>(args)...));
 }
 
 // Anonymous metafunction that concatenates everything into a single string
@@ -116,11 +167,11 @@ void PowerPlant::log(Arguments&&... args) {
     std::string output = output_stream.str();
 
     auto current_task = threading::ReactionTask::get_current_task();
-    auto task         = current_task ? current_task->stats.get() : nullptr;
+    auto task         = current_task ? current_task->get_stats() : nullptr;
 
     // Direct emit the log message so that any direct loggers can use it
     powerplant->emit<dsl::word::emit::Direct>(
-        std::make_unique<message::LogMessage>(message::LogMessage{level, output, task}));
+        std::make_unique<message::LogMessage>(message::LogMessage{level, output, std::move(task)}));
 }
 
 }  // namespace NUClear
@@ -60,8 +60,23 @@ namespace dsl {
         template <size_t, typename...>
         struct Last;
 
+        template <typename>
+        class LastView;
+
+        template <typename>
+        struct Filter;
+
+        template <int, typename, typename...>
+        struct Window;
+
+        template <typename...>
+        struct Latest;
+
         struct MainThread;
 
+        template <typename>
+        struct Pool;
+
         template <typename>
         struct Network;
 
@@ -77,9 +92,17 @@ namespace dsl {
 
         struct Shutdown;
 
-        template <int, typename>
+        template <int, typename, typename>
         struct Every;
 
+        struct EveryTick;
+
+        namespace every {
+            struct CatchUp;
+            struct Skip;
+            struct Align;
+        }  // namespace every
+
         template <typename, int, typename>
         struct Watchdog;
 
@@ -88,6 +111,8 @@ namespace dsl {
 
         struct Single;
 
+        struct Inline;
+
         template <int>
         struct Buffer;
 
@@ -100,6 +125,8 @@ namespace dsl {
             template <typename T>
             struct Direct;
             template <typename T>
+            struct Inline;
+            template <typename T>
             struct Delay;
             template <typename T>
             struct Initialise;
@@ -187,9 +214,29 @@ protected:
     template <size_t len, typename... DSL>
     using Last = dsl::word::Last<len, DSL...>;
 
+    /// @copydoc dsl::word::LastView
+    template <typename T>
+    using LastView = dsl::word::LastView<T>;
+
+    /// @copydoc dsl::word::Filter
+    template <typename Predicate>
+    using Filter = dsl::word::Filter<Predicate>;
+
+    /// @copydoc dsl::word::Window
+    template <int ticks, class period, typename... DSL>
+    using Window = dsl::word::Window<ticks, period, DSL...>;
+
+    /// @copydoc dsl::word::Latest
+    template <typename... DSL>
+    using Latest = dsl::word::Latest<DSL...>;
+
     /// @copydoc dsl::word::MainThread
     using MainThread = dsl::word::MainThread;
 
+    /// @copydoc dsl::word::Pool
+    template <typename PoolType>
+    using Pool = dsl::word::Pool<PoolType>;
+
     /// @copydoc dsl::word::Startup
     using Startup = dsl::word::Startup;
 
@@ -204,8 +251,23 @@ protected:
     using Shutdown = dsl::word::Shutdown;
 
     /// @copydoc dsl::word::Every
-    template <int ticks = 0, class period = std::chrono::milliseconds>
-    using Every = dsl::word::Every<ticks, period>;
+    template <int ticks = 0, class period = std::chrono::milliseconds, class Policy = dsl::word::every::CatchUp>
+    using Every = dsl::word::Every<ticks, period, Policy>;
+
+    /// @copydoc dsl::word::EveryTick
+    using EveryTick = dsl::word::EveryTick;
+
+    /// @brief The policies that choose what an Every does with ticks that are missed
+    struct EveryPolicy {
+        /// @copydoc dsl::word::every::CatchUp
+        using CATCH_UP = dsl::word::every::CatchUp;
+
+        /// @copydoc dsl::word::every::Skip
+        using SKIP = dsl::word::every::Skip;
+
+        /// @copydoc dsl::word::every::Align
+        using ALIGN = dsl::word::every::Align;
+    };
 
     /// @copydoc dsl::word::Every
     template <typename TWatchdog, int ticks, class period = std::chrono::milliseconds>
@@ -222,6 +284,9 @@ protected:
     /// @copydoc dsl::word::Single
     using Single = dsl::word::Single;
 
+    /// @copydoc dsl::word::Inline
+    using Inline = dsl::word::Inline;
+
     /// @copydoc dsl::word::Buffer
     template <int N>
     using Buffer = dsl::word::Buffer<N>;
@@ -235,6 +300,10 @@ protected:
         template <typename T>
         using DIRECT = dsl::word::emit::Direct<T>;
 
+        /// @copydoc dsl::word::emit::Inline
+        template <typename T>
+        using INLINE = dsl::word::emit::Inline<T>;
+
         /// @copydoc dsl::word::emit::Direct
         template <typename T>
         using DELAY = dsl::word::emit::Delay<T>;
@@ -352,6 +421,40 @@ public:
         powerplant.emit<Handlers...>(std::forward<std::unique_ptr<T>>(data), std::forward<Arguments>(args)...);
     }
 
+    /**
+     * @brief Makes data and emits it into the system so that other reactors can use it.
+     *
+     * @details
+     *  The data is made in a single allocation with its shared_ptr control block, see PowerPlant::emit_make.
+     *
+     * @tparam T        The type of the data we are emitting
+     * @tparam Handlers The handlers for this emit (e.g. LOCAL, DIRECT)
+     *
+     * @param args The arguments to construct T with
+     */
+    template <typename T, template <typename> class... Handlers, typename... Arguments>
+    void emit_make(Arguments&&... args) {
+        powerplant.emit_make<T, Handlers...>(std::forward<Arguments>(args)...);
+    }
+
+    /**
+     * @brief Emits a batch of data into the system so that other reactors can use it.
+     *
+     * @details
+     *  Each element is emitted in order as if it was emitted by itself, but the resulting tasks are all given to the
+     *  thread pool at once.
+     *
+     * @tparam Handlers The handlers for this emit (e.g. LOCAL)
+     * @tparam T        The type of the data we are emitting
+     *
+     * @param data The data to emit
+     */
+    template <template <typename> class... Handlers, typename T, typename... Arguments>
+    void emit(std::vector<std::unique_ptr<T>>&& data, Arguments&&... args) {
+        powerplant.emit<Handlers...>(std::forward<std::vector<std::unique_ptr<T>>>(data),
+                                     std::forward<Arguments>(args)...);
+    }
+
     /**
      * @brief Log a message through NUClear's system.
      *
@@ -380,11 +483,15 @@ public:
 #include "nuclear_bits/dsl/word/Always.hpp"
 #include "nuclear_bits/dsl/word/Buffer.hpp"
 #include "nuclear_bits/dsl/word/Every.hpp"
+#include "nuclear_bits/dsl/word/Filter.hpp"
 #include "nuclear_bits/dsl/word/IO.hpp"
+#include "nuclear_bits/dsl/word/Inline.hpp"
 #include "nuclear_bits/dsl/word/Last.hpp"
+#include "nuclear_bits/dsl/word/Latest.hpp"
 #include "nuclear_bits/dsl/word/MainThread.hpp"
 #include "nuclear_bits/dsl/word/Network.hpp"
 #include "nuclear_bits/dsl/word/Optional.hpp"
+#include "nuclear_bits/dsl/word/Pool.hpp"
 #include "nuclear_bits/dsl/word/Priority.hpp"
 #include "nuclear_bits/dsl/word/Shutdown.hpp"
 #include "nuclear_bits/dsl/word/Single.hpp"
@@ -394,10 +501,12 @@ public:
 #include "nuclear_bits/dsl/word/Trigger.hpp"
 #include "nuclear_bits/dsl/word/UDP.hpp"
 #include "nuclear_bits/dsl/word/Watchdog.hpp"
+#include "nuclear_bits/dsl/word/Window.hpp"
 #include "nuclear_bits/dsl/word/With.hpp"
 #include "nuclear_bits/dsl/word/emit/Delay.hpp"
 #include "nuclear_bits/dsl/word/emit/Direct.hpp"
 #include "nuclear_bits/dsl/word/emit/Initialise.hpp"
+#include "nuclear_bits/dsl/word/emit/Inline.hpp"
 #include "nuclear_bits/dsl/word/emit/Local.hpp"
 #include "nuclear_bits/dsl/word/emit/Network.hpp"
 #include "nuclear_bits/dsl/word/emit/UDP.hpp"
@@ -19,12 +19,29 @@
 #ifndef NUCLEAR_DSL_OPERATION_CHRONOTASK_HPP
 #define NUCLEAR_DSL_OPERATION_CHRONOTASK_HPP
 
+#include <functional>
+#include <memory>
+#include <vector>
+
 #include "nuclear_bits/clock.hpp"
 
 namespace NUClear {
+namespace threading {
+    class ReactionTask;
+}  // namespace threading
+
 namespace dsl {
     namespace operation {
 
+        /**
+         * @brief The reaction tasks made by the ChronoTasks that are due together.
+         *
+         * @details While the Chrono system runs the tasks that are due, a pointer to one of these is held in the
+         *          ThreadStore. ChronoTasks that make reaction tasks should add them to it when it is there, so they
+         *          can all be given to the thread pool in one batch.
+         */
+        using ChronoBatch = std::vector<std::unique_ptr<threading::ReactionTask>>;
+
         /**
          * @brief Emit to schedule a function to be run at a particular time.
          *
@@ -43,22 +43,25 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](threading::Reaction& r) {
-
-                    auto& vec = store::TypeCallbackStore<DataType>::get();
-
-                    auto item = std::find_if(
-                        std::begin(vec), std::end(vec), [&r](const std::shared_ptr<threading::Reaction>& item) {
-                            return item->id == r.id;
+                    uint64_t id = r.id;
+
+                    store::TypeCallbackStore<DataType>::modify(
+                        [id](std::vector<std::shared_ptr<threading::Reaction>>& vec) {
+                            auto item = std::find_if(
+                                std::begin(vec), std::end(vec), [id](const std::shared_ptr<threading::Reaction>& item) {
+                                    return item->id == id;
+                                });
+
+                            // If the item is in the list erase the item
+                            if (item != std::end(vec)) {
+                                vec.erase(item);
+                            }
                         });
-
-                    // If the item is in the list erase the item
-                    if (item != std::end(vec)) {
-                        vec.erase(item);
-                    }
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<DataType>::get().push_back(reaction);
+                store::TypeCallbackStore<DataType>::modify(
+                    [reaction](std::vector<std::shared_ptr<threading::Reaction>>& vec) { vec.push_back(reaction); });
             }
         };
 
@@ -73,22 +76,29 @@ namespace dsl {
 
                 // Our unbinder to remove this reaction
                 reaction->unbinders.push_back([](threading::Reaction& r) {
-
-                    auto& vec = store::TypeCallbackStore<message::ReactionStatistics>::get();
-
-                    auto item = std::find_if(
-                        std::begin(vec), std::end(vec), [&r](const std::shared_ptr<threading::Reaction>& item) {
-                            return item->id == r.id;
+                    uint64_t id = r.id;
+
+                    store::TypeCallbackStore<message::ReactionStatistics>::modify(
+                        [id](std::vector<std::shared_ptr<threading::Reaction>>& vec) {
+                            auto item = std::find_if(
+                                std::begin(vec), std::end(vec), [id](const std::shared_ptr<threading::Reaction>& item) {
+                                    return item->id == id;
+                                });
+
+                            // If the item is in the list erase the item and stop counting it as a listener
+                            if (item != std::end(vec)) {
+                                vec.erase(item);
+                                --threading::ReactionTask::statistics_listeners;
+                            }
                         });
-
-                    // If the item is in the list erase the item
-                    if (item != std::end(vec)) {
-                        vec.erase(item);
-                    }
                 });
 
                 // Create our reaction and store it in the TypeCallbackStore
-                store::TypeCallbackStore<message::ReactionStatistics>::get().push_back(reaction);
+                store::TypeCallbackStore<message::ReactionStatistics>::modify(
+                    [reaction](std::vector<std::shared_ptr<threading::Reaction>>& vec) {
+                        vec.push_back(reaction);
+                        ++threading::ReactionTask::statistics_listeners;
+                    });
             }
         };
 
@@ -0,0 +1,51 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_TRAIT_ALLOCATOR_HPP
+#define NUCLEAR_DSL_TRAIT_ALLOCATOR_HPP
+
+#include <memory>
+
+namespace NUClear {
+namespace dsl {
+    namespace trait {
+
+        /**
+         * @brief The allocator that is used to make messages of a type when they are emitted with emit_make
+         *
+         * @details By default messages are allocated with std::allocator. For messages that are emitted at a high
+         *          rate this can be specialised to use a NUClear::util::RecyclingAllocator so the memory for the
+         *          message and its shared_ptr control block is reused rather than freed.
+         *          @code
+         *          namespace NUClear { namespace dsl { namespace trait {
+         *              template <> struct allocator<Message> { using type = util::RecyclingAllocator<Message>; };
+         *          }}}
+         *          @endcode
+         *
+         * @tparam DataType the type of message that is being allocated
+         */
+        template <typename DataType>
+        struct allocator {
+            using type = std::allocator<DataType>;
+        };
+
+    }  // namespace trait
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_TRAIT_ALLOCATOR_HPP
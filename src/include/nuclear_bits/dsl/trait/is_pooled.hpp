@@ -0,0 +1,48 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_TRAIT_ISPOOLED_HPP
+#define NUCLEAR_DSL_TRAIT_ISPOOLED_HPP
+
+#include <type_traits>
+
+namespace NUClear {
+namespace dsl {
+    namespace trait {
+
+        /**
+         * @brief Indicates that objects of a type should be kept in a pool and reused rather than being destroyed
+         *
+         * @details When this trait is true, data of this type that is emitted will be given back to its
+         *          NUClear::util::ObjectPool once the last reference to it is dropped, rather than being deleted.
+         *          New objects can then be taken from the pool with acquire, keeping any memory they own (such as the
+         *          buffer of a std::vector) so it does not need to be allocated again.
+         *          Pooled types must be default constructible.
+         *
+         * @see NUClear::util::ObjectPool
+         *
+         * @tparam typename the datatype that is to be pooled
+         */
+        template <typename DataType>
+        struct is_pooled : public std::false_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_TRAIT_ISPOOLED_HPP
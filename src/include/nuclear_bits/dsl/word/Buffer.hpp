@@ -19,6 +19,8 @@
 #ifndef NUCLEAR_DSL_WORD_BUFFER_HPP
 #define NUCLEAR_DSL_WORD_BUFFER_HPP
 
+#include "nuclear_bits/threading/Reaction.hpp"
+
 namespace NUClear {
 namespace dsl {
     namespace word {
@@ -46,6 +48,11 @@ namespace dsl {
 
             template <typename DSL>
             static inline bool precondition(threading::Reaction& reaction) {
+                // Tell the reaction our limit so emitters can skip it without running its generator while it is full
+                if (reaction.max_active_tasks.load(std::memory_order_relaxed) > n) {
+                    reaction.max_active_tasks.store(n, std::memory_order_relaxed);
+                }
+
                 // We only run if there are less than the target number of active tasks
                 return reaction.active_tasks < (n + 1);
             }
@@ -22,6 +22,7 @@
 #include <cmath>
 #include "nuclear_bits/dsl/operation/ChronoTask.hpp"
 #include "nuclear_bits/dsl/operation/Unbind.hpp"
+#include "nuclear_bits/dsl/store/ThreadStore.hpp"
 #include "nuclear_bits/dsl/word/emit/Direct.hpp"
 
 namespace NUClear {
@@ -42,6 +43,107 @@ namespace dsl {
                                               * (double(clock::period::den) / double(clock::period::num)))) {}
         };
 
+        /**
+         * @brief
+         *  The data that is given to a periodic reaction each time it runs.
+         *
+         * @details
+         *  @code on<Every<10, std::chrono::milliseconds>>().then([](const EveryTick& tick) {}) @endcode
+         *  Periodic reactions do not need to take this argument, it is only passed if it is asked for.
+         */
+        struct EveryTick {
+
+            EveryTick() : time(), missed(0) {}
+
+            EveryTick(const NUClear::clock::time_point& time, uint64_t missed) : time(time), missed(missed) {}
+
+            /// @brief the time this tick was scheduled for
+            NUClear::clock::time_point time;
+            /// @brief the number of ticks since the last task for this reaction that did not make a task, either
+            /// because the policy skipped them or because the reaction did not want to run (e.g. it was Single)
+            uint64_t missed;
+
+            /// @brief a tick is always valid data, even when a reaction was not triggered by its Every
+            explicit operator bool() const {
+                return true;
+            }
+        };
+
+        namespace every {
+
+            /**
+             * @brief
+             *  After a stall, run a task for every tick that was missed until the reaction has caught up.
+             *
+             * @details
+             *  This is the default policy, and keeps the total number of tasks correct at the cost of a burst of
+             *  tasks after a stall.
+             */
+            struct CatchUp {
+
+                static inline NUClear::clock::time_point first(const NUClear::clock::time_point& now,
+                                                               const NUClear::clock::duration& jump) {
+                    return now + jump;
+                }
+
+                static inline uint64_t advance(NUClear::clock::time_point& time,
+                                               const NUClear::clock::time_point& /*now*/,
+                                               const NUClear::clock::duration& jump) {
+                    time += jump;
+                    return 0;
+                }
+            };
+
+            /**
+             * @brief
+             *  After a stall, skip any ticks that were missed and run on the next tick that is still in the future.
+             *
+             * @details
+             *  The ticks stay on the same grid as they would have without the stall, so there is no drift. The ticks
+             *  that were skipped do not make tasks, and are counted in EveryTick::missed.
+             */
+            struct Skip {
+
+                static inline NUClear::clock::time_point first(const NUClear::clock::time_point& now,
+                                                               const NUClear::clock::duration& jump) {
+                    return now + jump;
+                }
+
+                static inline uint64_t advance(NUClear::clock::time_point& time,
+                                               const NUClear::clock::time_point& now,
+                                               const NUClear::clock::duration& jump) {
+                    time += jump;
+
+                    // Jump over every tick that has already passed
+                    if (time <= now) {
+                        auto skipped = uint64_t((now - time) / jump) + 1;
+                        time += jump * skipped;
+                        return skipped;
+                    }
+                    return 0;
+                }
+            };
+
+            /**
+             * @brief
+             *  Like Skip, but the ticks are aligned to whole multiples of the period since NUClear::clock's epoch.
+             *
+             * @details
+             *  Reactions that share a period will all tick together. The ticks are only aligned to the wall clock when
+             *  NUClear::clock is the system_clock (as high_resolution_clock is with libstdc++). Where it is a steady
+             *  clock (such as with libc++ or MSVC) its epoch is usually when the system booted, so a reaction that
+             *  runs every second will not run as each second of the wall clock starts.
+             */
+            struct Align : public Skip {
+
+                static inline NUClear::clock::time_point first(const NUClear::clock::time_point& now,
+                                                               const NUClear::clock::duration& jump) {
+                    return NUClear::clock::time_point(jump * (now.time_since_epoch() / jump + 1));
+                }
+            };
+
+        }  // namespace every
+
         /**
          * @brief
          *  This is used to request any periodic reactions in the system.
@@ -59,12 +161,18 @@ namespace dsl {
          *  request would be used:
          *  @code on<Every<2, Per<std::chrono::seconds>>() @endcode
          *
+         *  A policy can be given to choose what happens when ticks are missed because the system stalled. By default
+         *  every missed tick is run as soon as possible (every::CatchUp). Missed ticks can instead be skipped
+         *  (every::Skip), or skipped with the ticks aligned to multiples of the period (every::Align).
+         *  @code on<Every<100, Per<std::chrono::seconds>, every::Skip>() @endcode
+         *  Reactions can take an EveryTick argument to find out how many ticks they missed.
+         *
          * @attention
          *  The period which is used to measure the ticks must be greater than or equal to clock::duration or the
          *  program will not compile.
          *
          * @par Implements
-         *  Bind
+         *  Bind, Get
          *
          * @tparam ticks
          *  the number of ticks of a particular type to wait
@@ -73,12 +181,14 @@ namespace dsl {
          *  duration, but can accept any of the defined std::chrono durations (nanoseconds, microseconds, milliseconds,
          *  seconds, minutes, hours).  Note that you can also define your own unit:  See
          *  http://en.cppreference.com/w/cpp/chrono/duration
+         * @tparam Policy
+         *  what to do with ticks that are missed (every::CatchUp, every::Skip or every::Align)
          */
-        template <int ticks = 0, class period = NUClear::clock::duration>
+        template <int ticks = 0, class period = NUClear::clock::duration, class Policy = every::CatchUp>
         struct Every;
 
-        template <>
-        struct Every<0, NUClear::clock::duration> {
+        template <class Policy>
+        struct Every<0, NUClear::clock::duration, Policy> {
 
             template <typename DSL>
             static inline void bind(const std::shared_ptr<threading::Reaction>& reaction,
@@ -90,13 +200,28 @@ namespace dsl {
 
                 // Send our configuration out
                 reaction->reactor.emit<emit::Direct>(std::make_unique<operation::ChronoTask>(
-                    [reaction, jump](NUClear::clock::time_point& time) {
+                    [reaction, jump, missed = uint64_t(0)](NUClear::clock::time_point& time) mutable {
+
+                        // Let the reaction know which tick this is
+                        EveryTick tick(time, missed);
+                        store::ThreadStore<EveryTick>::value = &tick;
 
                         try {
                             // submit the reaction to the thread pool
                             auto task = reaction->get_task();
                             if (task) {
-                                reaction->reactor.powerplant.submit(std::move(task));
+                                // Join the chrono controller's batch if it is making one, otherwise submit now
+                                auto batch = store::ThreadStore<operation::ChronoBatch>::value;
+                                if (batch != nullptr) {
+                                    batch->push_back(std::move(task));
+                                }
+                                else {
+                                    reaction->reactor.powerplant.submit(std::move(task));
+                                }
+                                missed = 0;
+                            }
+                            else {
+                                ++missed;
                             }
                         }
                         // If there is an exception while generating a reaction print it here, this shouldn't happen
@@ -109,21 +234,30 @@ namespace dsl {
                                 "There was an unknown exception while generating a reaction");
                         }
 
-                        time += jump;
+                        store::ThreadStore<EveryTick>::value = nullptr;
+
+                        // Move on to the next tick, counting any that our policy skips
+                        missed += Policy::advance(time, NUClear::clock::now(), jump);
 
                         return true;
                     },
-                    NUClear::clock::now() + jump,
+                    Policy::first(NUClear::clock::now(), jump),
                     reaction->id));
             }
+
+            template <typename DSL>
+            static inline EveryTick get(threading::Reaction& /*reaction*/) {
+                EveryTick* tick = store::ThreadStore<EveryTick>::value;
+                return tick != nullptr ? *tick : EveryTick();
+            }
         };
 
-        template <int ticks, class period>
-        struct Every {
+        template <int ticks, class period, class Policy>
+        struct Every : public Every<0, NUClear::clock::duration, Policy> {
 
             template <typename DSL>
             static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
-                Every<>::bind<DSL>(reaction, period(ticks));
+                Every<0, NUClear::clock::duration, Policy>::template bind<DSL>(reaction, period(ticks));
             }
         };
 
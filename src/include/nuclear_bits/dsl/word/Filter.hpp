@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_FILTER_HPP
+#define NUCLEAR_DSL_WORD_FILTER_HPP
+
+#include <tuple>
+#include <type_traits>
+
+#include "nuclear_bits/dsl/operation/CacheGet.hpp"
+#include "nuclear_bits/util/CallableInfo.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to only run a reaction when the data it was triggered with passes a test.
+         *
+         * @details
+         *  @code
+         *  struct IsCamera3 {
+         *      bool operator()(const Image& image) const { return image.camera_id == 3; }
+         *  };
+         *  on<Trigger<Image>, Filter<IsCamera3>>()
+         *  @endcode
+         *  The predicate is a default constructible type whose call operator takes the data to test. It is run in the
+         *  emitting thread before any data is bound for the reaction, so when it returns false no task is created,
+         *  queued or run at all. The data it is given is the data being emitted if it is the type that was emitted,
+         *  otherwise the latest data of that type. If there is no data of that type yet the reaction does not run.
+         *
+         *  Predicates should be cheap as they hold up the emitting thread.
+         *
+         * @par Implements
+         *  Precondition
+         *
+         * @tparam Predicate the type of the test to run on the data
+         */
+        template <typename Predicate>
+        struct Filter {
+
+            /// @brief the type of data the predicate tests
+            using DataType =
+                std::decay_t<std::tuple_element_t<0, typename util::CallableInfo<Predicate>::arguments>>;
+
+            template <typename DSL>
+            static inline bool precondition(threading::Reaction& reaction) {
+                auto data = operation::CacheGet<DataType>::template get<DSL>(reaction);
+                return data && Predicate()(*data);
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_FILTER_HPP
@@ -61,6 +61,10 @@ namespace dsl {
          *  matches multiple states.  For example;
          *  @code on<IO>(pipe/stream/comms, IO::READ | IO::ERROR) @endcode
          *
+         *  On Linux file descriptors are watched using epoll, which stops watching a file descriptor once it is
+         *  closed. This means that IO::ERROR will not trigger for a file descriptor that was closed while it was
+         *  being watched, as it would with poll on other systems. Unbind the reaction before closing the descriptor.
+         *
          * @attention
          *  Note that reactions triggered by an on<IO> request are implicitly single.
          *
@@ -0,0 +1,58 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_INLINE_HPP
+#define NUCLEAR_DSL_WORD_INLINE_HPP
+
+#include "nuclear_bits/threading/Reaction.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief
+         *  This is used to mark a reaction as cheap enough to run in the thread that emits its data.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Inline>() @endcode
+         *  When data is emitted using Scope::INLINE, reactions marked with this word will be run immediately in the
+         *  emitting thread, as if the data had been emitted with Scope::DIRECT. All other reactions will be given to
+         *  the thread pool, as if the data had been emitted with Scope::LOCAL.
+         *
+         *  This should only be used for reactions that do very little work (such as copying the data somewhere) as
+         *  the emitter will be paused while they run.
+         *
+         *  For best use, this word should be fused with at least one other binding DSL word.
+         *
+         * @par Implements
+         *  Bind
+         */
+        struct Inline {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                reaction->run_inline = true;
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_INLINE_HPP
@@ -19,50 +19,160 @@
 #ifndef NUCLEAR_DSL_WORD_LAST_HPP
 #define NUCLEAR_DSL_WORD_LAST_HPP
 
+#include <algorithm>
 #include <list>
+#include <memory>
 #include <type_traits>
+#include <vector>
 #include "nuclear_bits/util/MergeTransient.hpp"
 
 namespace NUClear {
 namespace dsl {
     namespace word {
 
-        template <size_t n, typename T>
-        struct LastItemStorage {
-            // The items we are storing
-            std::list<T> list;
+        /**
+         * @brief A read only view of the items a Last or Window reaction was given, oldest first.
+         *
+         * @details
+         *  The view shares its items with the history kept by the reaction so getting one does not copy anything.
+         *  Reactions can take this type as an argument in place of a std::list or std::vector to avoid that copy.
+         *  @code on<Last<n, Trigger<T>>>().then([](const LastView<std::shared_ptr<const T>>& items) {}) @endcode
+         *
+         * @tparam T the type of the items in the view
+         */
+        template <typename T>
+        class LastView {
+        public:
+            using const_iterator = typename std::vector<T>::const_iterator;
 
-            LastItemStorage() : list() {}
+            LastView() : items(), first(0), last(0) {}
 
-            LastItemStorage(T&& data) : list({data}) {}
+            LastView(std::shared_ptr<const std::vector<T>> items, size_t first, size_t last)
+                : items(std::move(items)), first(first), last(last) {}
 
-            template <typename Output>
-            operator std::list<Output>() const {
+            const_iterator begin() const {
+                return items ? items->begin() + first : const_iterator();
+            }
 
-                std::list<Output> out;
+            const_iterator end() const {
+                return items ? items->begin() + last : const_iterator();
+            }
 
-                for (const T& item : list) {
-                    out.push_back(Output(item));
-                }
+            size_t size() const {
+                return last - first;
+            }
+
+            bool empty() const {
+                return last == first;
+            }
+
+            const T& operator[](size_t i) const {
+                return (*items)[first + i];
+            }
+
+            const T& front() const {
+                return (*items)[first];
+            }
+
+            const T& back() const {
+                return (*items)[last - 1];
+            }
 
-                return out;
+            template <typename Output>
+            operator std::list<Output>() const {
+                return std::list<Output>(begin(), end());
             }
 
             template <typename Output>
             operator std::vector<Output>() const {
+                return std::vector<Output>(begin(), end());
+            }
 
-                std::vector<Output> out;
+        private:
+            /// @brief the buffer that holds our items (and possibly newer and older ones outside our range)
+            std::shared_ptr<const std::vector<T>> items;
+            /// @brief the index of our first item in the buffer
+            size_t first;
+            /// @brief one past the index of our last item in the buffer
+            size_t last;
+        };
 
-                for (const T& item : list) {
-                    out.push_back(Output(item));
+        /**
+         * @brief A history of items that is only ever appended to, so every task can share it without copying.
+         *
+         * @details
+         *  Items are written into a fixed size buffer that is shared between the history and the views given to tasks.
+         *  An item is never changed once it is written, so a view only needs to remember which part of the buffer it
+         *  covers. When the buffer is full the items that are still needed are moved into a new buffer and the old one
+         *  is freed once the last view using it is gone.
+         *
+         * @tparam T the type of the items in the history
+         */
+        template <typename T>
+        struct HistoryStorage {
+
+            HistoryStorage() : items(), first(0), last(0) {}
+
+            HistoryStorage(T&& data) : items(std::make_shared<std::vector<T>>(1)), first(0), last(1) {
+                (*items)[0] = std::move(data);
+            }
+
+            /// @brief adds the items from other to the end of our history, making room if our buffer is full
+            void append(const HistoryStorage& other, size_t capacity) {
+                size_t incoming = other.last - other.first;
+
+                if (!items || last + incoming > items->size()) {
+                    auto next = std::make_shared<std::vector<T>>(std::max(capacity, size() + incoming));
+                    std::copy(items ? items->begin() + first : next->begin(),
+                              items ? items->begin() + last : next->begin(),
+                              next->begin());
+                    last  = size();
+                    first = 0;
+                    items = std::move(next);
+                }
+
+                for (size_t i = other.first; i < other.last; ++i) {
+                    (*items)[last++] = (*other.items)[i];
                 }
+            }
 
-                return out;
+            /// @brief the number of items in the history
+            size_t size() const {
+                return last - first;
+            }
+
+            operator LastView<T>() const {
+                return LastView<T>(items, first, last);
+            }
+
+            template <typename Output>
+            operator std::list<Output>() const {
+                return LastView<T>(*this);
+            }
+
+            template <typename Output>
+            operator std::vector<Output>() const {
+                return LastView<T>(*this);
             }
 
             operator bool() const {
-                return !list.empty();
+                return last != first;
             }
+
+            /// @brief the buffer that the items are written into
+            std::shared_ptr<std::vector<T>> items;
+            /// @brief the index of the oldest item in the buffer that is part of the history
+            size_t first;
+            /// @brief one past the index of the newest item in the buffer
+            size_t last;
+        };
+
+        template <size_t n, typename T>
+        struct LastItemStorage : public HistoryStorage<T> {
+
+            LastItemStorage() = default;
+
+            LastItemStorage(T&& data) : HistoryStorage<T>(std::move(data)) {}
         };
 
         /**
@@ -148,17 +258,16 @@ namespace util {
     struct MergeTransients<dsl::word::LastItemStorage<n, T>> {
         static inline bool merge(dsl::word::LastItemStorage<n, T>& t, dsl::word::LastItemStorage<n, T>& d) {
 
-            // We put the contents from data into the transient storage list
-            t.list.insert(t.list.end(), d.list.begin(), d.list.end());
+            // We add the new data to the end of the transient history, with room for n more before we copy again
+            t.append(d, 2 * n);
 
-            // Then truncate the old transient data
-            if (t.list.size() > n) {
-                t.list.erase(t.list.begin(), std::next(t.list.begin(), t.list.size() - n));
+            // Then drop anything older than the last n items
+            if (t.size() > n) {
+                t.first = t.last - n;
             }
 
-            // Finally clear the data list and put the transient list in it
-            d.list.clear();
-            d.list.insert(d.list.begin(), t.list.begin(), t.list.end());
+            // Finally give the data a view of the shared history
+            d = t;
 
             return true;
         };
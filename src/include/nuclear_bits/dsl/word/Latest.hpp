@@ -0,0 +1,215 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_LATEST_HPP
+#define NUCLEAR_DSL_WORD_LATEST_HPP
+
+#include <memory>
+#include <mutex>
+#include <type_traits>
+
+#include "nuclear_bits/util/MergeTransient.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        /**
+         * @brief The newest value for a reaction, and whether a task is already waiting to process it.
+         *
+         * @details
+         *  One of these is kept by each Latest reaction for each piece of data it gets. Emits overwrite the value, and
+         *  tasks take it when they run.
+         */
+        template <typename T>
+        struct LatestSlot {
+            /// @brief lock for the value and the pending flag
+            std::mutex mutex;
+            /// @brief the newest value that has been given to the reaction
+            T value;
+            /// @brief if there is a task that has not yet taken the value
+            bool pending = false;
+
+            /// @brief take the newest value, after which the next emit will make a new task
+            T take() {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending = false;
+                return value;
+            }
+
+            /// @brief release the pending flag without taking the value (the task did not need it)
+            void release() {
+                std::lock_guard<std::mutex> lock(mutex);
+                pending = false;
+            }
+        };
+
+        /**
+         * @brief A task's claim on a LatestSlot, the value is only taken from the slot once the task needs it.
+         */
+        template <typename T>
+        struct LatestTicket {
+
+            LatestTicket(std::shared_ptr<LatestSlot<T>> slot) : slot(std::move(slot)), taken(false) {}
+
+            ~LatestTicket() {
+                // If the task never looked at the data (or never ran) let the next emit make a new task
+                if (!taken) {
+                    slot->release();
+                }
+            }
+
+            LatestTicket(const LatestTicket&) = delete;
+            LatestTicket& operator=(const LatestTicket&) = delete;
+
+            T& get() {
+                if (!taken) {
+                    value = slot->take();
+                    taken = true;
+                }
+                return value;
+            }
+
+            /// @brief the slot this ticket will take its value from
+            std::shared_ptr<LatestSlot<T>> slot;
+            /// @brief if we have taken the value from the slot yet
+            bool taken;
+            /// @brief the value once it has been taken
+            T value;
+        };
+
+        template <typename T>
+        struct LatestItemStorage {
+
+            /// @brief the reaction's storage, which owns the slot that all of its tasks share
+            LatestItemStorage() : slot(std::make_shared<LatestSlot<T>>()) {}
+
+            /// @brief the data for a single task, which is moved into the slot when it is merged
+            LatestItemStorage(T&& data) : value(std::move(data)) {}
+
+            template <typename U = T>
+            auto operator*() const -> decltype(*std::declval<U&>()) {
+                return *ticket->get();
+            }
+
+            operator T() const {
+                return ticket->get();
+            }
+
+            operator bool() const {
+                return ticket != nullptr;
+            }
+
+            /// @brief the reaction's slot (only set for the reaction's storage)
+            std::shared_ptr<LatestSlot<T>> slot;
+            /// @brief the data as it was when the task was triggered (until it is merged into the slot)
+            T value;
+            /// @brief the task's claim on the slot (only set for a task that should run)
+            std::shared_ptr<LatestTicket<T>> ticket;
+        };
+
+        /**
+         * @brief
+         *  This instructs the powerplant to conflate the messages (of the associated type) so the subscribing reaction
+         *  only ever processes the newest one.
+         *
+         * @details
+         *  @code on<Latest<Trigger<T, ...>>>() @endcode
+         *  At most one task for the reaction will be waiting to run at any time. When a message arrives while a task is
+         *  already waiting, the message replaces the one the waiting task will process rather than creating a new
+         *  task. When the task runs it will get the newest message that arrived before it started, not the one that
+         *  triggered it.
+         *
+         *  A task that is already running does not count as waiting, so one more task can be created while it runs.
+         *  This means a slow reaction will always process the newest message next, where Single would drop it.
+         *
+         *  This word is a modifier, and should  be used to modify any "Get" DSL word.
+         *
+         * @par Multiple Statements
+         *  @code on<Latest<Trigger<T1>, With<T2>>() @endcode
+         *  When applying this modifier to multiple get statements, each statement is conflated on its own. In this
+         *  example the task will get the newest T1 that triggered the reaction, and the T2 that was available when that
+         *  T1 triggered it.
+         *
+         * @par Implements
+         *  Modification
+         *
+         * @tparam DSLWords
+         *  the DSL word/activity being modified.
+         */
+        template <typename... DSLWords>
+        struct Latest : public Fusion<DSLWords...> {
+
+        private:
+            template <typename... T, int... Index>
+            static inline auto wrap(std::tuple<T...>&& data, util::Sequence<Index...>)
+                -> decltype(std::make_tuple(LatestItemStorage<T>(std::move(std::get<Index>(data)))...)) {
+                return std::make_tuple(LatestItemStorage<T>(std::move(std::get<Index>(data)))...);
+            }
+
+        public:
+            template <typename DSL>
+            static inline auto get(threading::Reaction& r)
+                -> decltype(wrap(Fusion<DSLWords...>::template get<DSL>(r),
+                                 util::GenerateSequence<0,
+                                                        std::tuple_size<decltype(
+                                                            Fusion<DSLWords...>::template get<DSL>(r))>::value>())) {
+
+                // Wrap all of our data in latest wrappers
+                return wrap(Fusion<DSLWords...>::template get<DSL>(r),
+                            util::GenerateSequence<0,
+                                                   std::tuple_size<decltype(
+                                                       Fusion<DSLWords...>::template get<DSL>(r))>::value>());
+            }
+        };
+
+    }  // namespace word
+
+    namespace trait {
+
+        template <typename T>
+        struct is_transient<word::LatestItemStorage<T>> : public std::true_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+
+namespace util {
+
+    template <typename T>
+    struct MergeTransients<dsl::word::LatestItemStorage<T>> {
+        static inline bool merge(dsl::word::LatestItemStorage<T>& t, dsl::word::LatestItemStorage<T>& d) {
+
+            std::lock_guard<std::mutex> lock(t.slot->mutex);
+
+            // Whatever happens this is now the newest value
+            t.slot->value = std::move(d.value);
+
+            // If a task is already waiting it will pick up the new value, so we don't need another one
+            if (!t.slot->pending) {
+                t.slot->pending = true;
+                d.ticket        = std::make_shared<dsl::word::LatestTicket<T>>(t.slot);
+            }
+
+            return true;
+        };
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_LATEST_HPP
@@ -0,0 +1,113 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_POOL_HPP
+#define NUCLEAR_DSL_WORD_POOL_HPP
+
+#include <typeindex>
+#include <vector>
+
+#include "nuclear_bits/threading/ReactionTask.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        namespace pool {
+
+            // Use the CPUs the pool type asks for if it provides them
+            template <typename PoolType>
+            inline auto cpus(int) -> decltype(PoolType::cpus()) {
+                return PoolType::cpus();
+            }
+
+            // Otherwise the threads of the pool are not pinned
+            template <typename PoolType>
+            inline std::vector<int> cpus(...) {
+                return std::vector<int>();
+            }
+
+        }  // namespace pool
+
+        /**
+         * @brief
+         *  This is used to specify that the associated task will execute in a separate thread pool.
+         *
+         * @details
+         *  @code on<Trigger<T, ...>, Pool<PoolType>>() @endcode
+         *  The PoolType describes the pool. It must have a static thread_count member with the number of threads in
+         *  the pool, and can have a static cpus() function that returns a std::vector<int> of the CPUs that the
+         *  pool's threads should be pinned to.
+         *
+         *  @code
+         *  struct CameraPool {
+         *      static constexpr size_t thread_count = 2;
+         *      static std::vector<int> cpus() { return {2, 3}; }
+         *  };
+         *  @endcode
+         *
+         *  Every reaction that uses the same PoolType runs in the same pool. This can be used to keep related work
+         *  on its own CPUs (for example on one socket of a multi socket machine) away from the main thread pool.
+         *
+         *  For best use, this word should be fused with at least one other binding DSL word.
+         *
+         * @attention
+         *  Pools must be created before the PowerPlant is started, so reactions using this word must be bound before
+         *  the PowerPlant starts.
+         *
+         * @par Implements
+         *  Bind, Reschedule
+         *
+         * @tparam PoolType the type that describes the pool
+         */
+        template <typename PoolType>
+        struct Pool {
+
+            template <typename DSL>
+            static inline void bind(const std::shared_ptr<threading::Reaction>& reaction) {
+                reaction->reactor.powerplant.add_pool(
+                    typeid(PoolType), PoolType::thread_count, pool::cpus<PoolType>(0));
+            }
+
+            template <typename DSL>
+            static inline std::unique_ptr<threading::ReactionTask> reschedule(
+                std::unique_ptr<threading::ReactionTask>&& task) {
+
+                auto& powerplant = task->parent.reactor.powerplant;
+
+                // If we are not in our pool, move us to it
+                if (!powerplant.in_pool(typeid(PoolType))) {
+
+                    // Submit to our pools scheduler
+                    powerplant.submit_pool(typeid(PoolType), std::move(task));
+
+                    // We took the task away so return null
+                    return std::unique_ptr<threading::ReactionTask>(nullptr);
+                }
+                // Otherwise run!
+                else {
+                    return std::move(task);
+                }
+            }
+        };
+
+    }  // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_POOL_HPP
@@ -19,6 +19,11 @@
 #ifndef NUCLEAR_DSL_WORD_SYNC_HPP
 #define NUCLEAR_DSL_WORD_SYNC_HPP
 
+#include <atomic>
+
+#include "nuclear_bits/threading/ReactionTask.hpp"
+#include "nuclear_bits/threading/TaskQueue.hpp"
+
 namespace NUClear {
 namespace dsl {
     namespace word {
@@ -34,10 +39,13 @@ namespace dsl {
          *  Should another task from this group be scheduled/requested (during execution of the current task), it will
          *  be sidelined into a priority queue.
          *
-         *  Upon completion of the currently executing task, the queue will be polled to allow execution of the next
-         *  task in this group.
+         *  Upon completion of the currently executing task, the queue will be polled and the next task in this group
+         *  will be run by the same thread straight away, rather than going back through the thread pool. If the
+         *  task finished on a thread outside of the thread pool (such as the main thread) the next task is given to
+         *  the thread pool instead.
          *
-         *  Tasks in the synchronization queue are ordered based on their priority level, then their emission timestamp.
+         *  Tasks in the synchronization queue are ordered based on their priority level, then the order they were
+         *  created in.
          *
          *  For best use, this word should be fused with at least one other binding DSL word.
          *
@@ -52,7 +60,7 @@ namespace dsl {
          *  NUClear will have task and thread control so that system resources can be efficiently managed.
          *
          * @par Implements
-         *  Pre-condition, Post-condition
+         *  Reschedule, Post-condition
          *
          * @tparam SyncGroup
          *  the type/group to synchronize on.  This needs to be a declared type within the system.  It is common to
@@ -66,59 +74,98 @@ namespace dsl {
             using task_ptr = std::unique_ptr<threading::ReactionTask>;
 
             /// @brief our queue which sorts tasks by priority
-            static std::priority_queue<task_ptr> queue;
-            /// @brief how many tasks are currently running
-            static volatile bool running;
-            /// @brief a mutex to ensure data consistency
-            static std::mutex mutex;
+            static threading::TaskQueue queue;
+            /// @brief if a task from this group currently holds the group
+            static std::atomic<bool> running;
+            /// @brief the task that currently holds the group, it can be rescheduled again without waiting
+            static std::atomic<threading::ReactionTask*> owner;
+
+            /**
+             * @brief Takes the group and the next task from the queue if nobody holds the group.
+             *
+             * @details
+             *  If the group is released while a task is being pushed, either the pusher will see the group is free or
+             *  the thread that released it will see the pushed task, so there is no need to wait for each other.
+             *
+             * @return the task that now holds the group, or nullptr if it is held or there is no task ready
+             */
+            static std::unique_ptr<threading::ReactionTask> take() {
+
+                // Our push or release of the group must be seen by others before we look at what they have done
+                std::atomic_thread_fence(std::memory_order_seq_cst);
+
+                while (queue.priority() != threading::TaskQueue::EMPTY) {
+
+                    // Somebody else holds the group, they will run this task when they are done
+                    if (running.exchange(true)) {
+                        return std::unique_ptr<threading::ReactionTask>(nullptr);
+                    }
+
+                    std::unique_ptr<threading::ReactionTask> next_task = queue.pop();
+                    if (next_task) {
+                        owner = next_task.get();
+                        return next_task;
+                    }
+
+                    // Another push has not finished yet, give the group back and that pusher will take it
+                    running = false;
+                }
+                return std::unique_ptr<threading::ReactionTask>(nullptr);
+            }
 
             template <typename DSL>
             static inline std::unique_ptr<threading::ReactionTask> reschedule(
                 std::unique_ptr<threading::ReactionTask>&& task) {
 
-                // Lock our mutex
-                std::lock_guard<std::mutex> lock(mutex);
+                // This task already holds the group (it may be moving to another thread) so it can just run
+                if (owner.load() == task.get()) {
+                    return std::move(task);
+                }
+
+                // Wait in the queue for our turn, and if the group is free take it for the first task in line
+                auto& powerplant              = task->parent.reactor.powerplant;
+                threading::ReactionTask* ours = task.get();
+                queue.push(std::move(task));
+                std::unique_ptr<threading::ReactionTask> next_task = take();
 
-                // If we are already running then queue, otherwise return and set running
-                if (running) {
-                    queue.push(std::move(task));
-                    return std::unique_ptr<threading::ReactionTask>(nullptr);
+                if (next_task.get() == ours) {
+                    return next_task;
                 }
-                else {
-                    running = true;
-                    return std::move(task);
+                if (next_task) {
+                    powerplant.submit(std::move(next_task));
                 }
+                return std::unique_ptr<threading::ReactionTask>(nullptr);
             }
 
             template <typename DSL>
             static void postcondition(threading::ReactionTask& task) {
 
-                // Lock our mutex
-                std::lock_guard<std::mutex> lock(mutex);
-
-                // We are finished running
+                // We are done with the group
+                owner   = nullptr;
                 running = false;
 
-                // If we have another task, add it
-                if (!queue.empty()) {
-                    std::unique_ptr<threading::ReactionTask> next_task(
-                        std::move(const_cast<std::unique_ptr<threading::ReactionTask>&>(queue.top())));
-                    queue.pop();
+                // Hand the group to the next task waiting for it
+                std::unique_ptr<threading::ReactionTask> next_task = take();
+                if (next_task) {
 
-                    // Resubmit this task to the reaction queue
-                    task.parent.reactor.powerplant.submit(std::move(next_task));
+                    // Run it on this thread if it is a thread pool thread and doesn't already have something to run
+                    // next, otherwise it could end up on the main thread or in another pool
+                    auto& powerplant = task.parent.reactor.powerplant;
+                    if (!powerplant.in_default_pool() || !threading::ReactionTask::run_next(std::move(next_task))) {
+                        powerplant.submit(std::move(next_task));
+                    }
                 }
             }
         };
 
         template <typename SyncGroup>
-        std::priority_queue<typename Sync<SyncGroup>::task_ptr> Sync<SyncGroup>::queue;
+        threading::TaskQueue Sync<SyncGroup>::queue(256);
 
         template <typename SyncGroup>
-        volatile bool Sync<SyncGroup>::running = false;
+        std::atomic<bool> Sync<SyncGroup>::running(false);
 
         template <typename SyncGroup>
-        std::mutex Sync<SyncGroup>::mutex;
+        std::atomic<threading::ReactionTask*> Sync<SyncGroup>::owner(nullptr);
 
     }  // namespace word
 }  // namespace dsl
@@ -21,6 +21,7 @@
 
 #include "nuclear_bits/dsl/operation/Unbind.hpp"
 #include "nuclear_bits/dsl/store/DataStore.hpp"
+#include "nuclear_bits/dsl/store/ThreadStore.hpp"
 #include "nuclear_bits/dsl/word/emit/Direct.hpp"
 #include "nuclear_bits/message/ServiceWatchdog.hpp"
 
@@ -107,7 +108,14 @@ namespace dsl {
                                 // Submit the reaction to the thread pool
                                 auto task = reaction->get_task();
                                 if (task) {
-                                    reaction->reactor.powerplant.submit(std::move(task));
+                                    // Join the chrono controller's batch if it is making one, otherwise submit now
+                                    auto batch = store::ThreadStore<operation::ChronoBatch>::value;
+                                    if (batch != nullptr) {
+                                        batch->push_back(std::move(task));
+                                    }
+                                    else {
+                                        reaction->reactor.powerplant.submit(std::move(task));
+                                    }
                                 }
                             }
                             catch (...) {
@@ -0,0 +1,143 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_WINDOW_HPP
+#define NUCLEAR_DSL_WORD_WINDOW_HPP
+
+#include <algorithm>
+#include <deque>
+#include <type_traits>
+
+#include "nuclear_bits/clock.hpp"
+#include "nuclear_bits/dsl/word/Last.hpp"
+#include "nuclear_bits/util/MergeTransient.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+
+        template <int ticks, typename period, typename T>
+        struct WindowItemStorage : public HistoryStorage<T> {
+
+            WindowItemStorage() = default;
+
+            WindowItemStorage(T&& data) : HistoryStorage<T>(std::move(data)) {}
+
+            /// @brief when each of the items in the history arrived, oldest first (only kept by the reaction)
+            std::deque<NUClear::clock::time_point> times;
+        };
+
+        /**
+         * @brief
+         *  This instructs the powerplant to store the messages (of the associated type) from a recent period of time
+         *  and provide read-only access to them to the subscribing reaction.
+         *
+         * @details
+         *  @code on<Window<50, std::chrono::milliseconds, Trigger<T, ...>>>() @endcode
+         *  During system runtime, the PowerPlant will keep a record of the messages that were provided to the
+         *  subscribing reaction within the last ticks * period. This list is ordered such that the oldest element is
+         *  first, and the newest element is last. Each time a new task is triggered the new message is appended to the
+         *  list, and any messages that arrived longer ago than the window are dropped.
+         *
+         *  Like Last, the history is shared between the reaction and its tasks so a task can take a LastView of it
+         *  without copying anything.
+         *
+         *  This word is a modifier, and should  be used to modify any "Get" DSL word.
+         *
+         * @par Multiple Statements
+         *  @code on<Window<50, std::chrono::milliseconds, Trigger<T1>, With<T2>>() @endcode
+         *  When applying this modifier to multiple get statements, a list will be returned for each statement, each
+         *  holding the data that was available when each of the tasks in the window were triggered.
+         *
+         * @par Implements
+         *  Modification
+         *
+         * @tparam ticks
+         *  the number of periods in the window
+         * @tparam period
+         *  the unit of time the ticks are measured in
+         * @tparam DSLWords
+         *  the DSL word/activity being modified.
+         */
+        template <int ticks, typename period, typename... DSLWords>
+        struct Window : public Fusion<DSLWords...> {
+
+        private:
+            template <typename... T, int... Index>
+            static inline auto wrap(std::tuple<T...>&& data, util::Sequence<Index...>)
+                -> decltype(std::make_tuple(WindowItemStorage<ticks, period, T>(std::move(std::get<Index>(data)))...)) {
+                return std::make_tuple(WindowItemStorage<ticks, period, T>(std::move(std::get<Index>(data)))...);
+            }
+
+        public:
+            template <typename DSL>
+            static inline auto get(threading::Reaction& r)
+                -> decltype(wrap(Fusion<DSLWords...>::template get<DSL>(r),
+                                 util::GenerateSequence<0,
+                                                        std::tuple_size<decltype(
+                                                            Fusion<DSLWords...>::template get<DSL>(r))>::value>())) {
+
+                // Wrap all of our data in window wrappers
+                return wrap(Fusion<DSLWords...>::template get<DSL>(r),
+                            util::GenerateSequence<0,
+                                                   std::tuple_size<decltype(
+                                                       Fusion<DSLWords...>::template get<DSL>(r))>::value>());
+            }
+        };
+
+    }  // namespace word
+
+    namespace trait {
+
+        template <int ticks, typename period, typename T>
+        struct is_transient<word::WindowItemStorage<ticks, period, T>> : public std::true_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+
+namespace util {
+
+    template <int ticks, typename period, typename T>
+    struct MergeTransients<dsl::word::WindowItemStorage<ticks, period, T>> {
+        static inline bool merge(dsl::word::WindowItemStorage<ticks, period, T>& t,
+                                 dsl::word::WindowItemStorage<ticks, period, T>& d) {
+
+            NUClear::clock::time_point now = NUClear::clock::now();
+
+            // Add the new data to the history, leaving room for it to double before we have to copy it again
+            t.append(d, std::max<size_t>(16, 2 * (t.size() + d.size())));
+            t.times.insert(t.times.end(), d.size(), now);
+
+            // Drop anything that arrived before the start of the window
+            auto start = now - std::chrono::duration_cast<NUClear::clock::duration>(period(ticks));
+            while (!t.times.empty() && t.times.front() < start) {
+                t.times.pop_front();
+                ++t.first;
+            }
+
+            // Give the data a view of the shared history (but not the arrival times, only we need those)
+            static_cast<dsl::word::HistoryStorage<T>&>(d) = t;
+
+            return true;
+        };
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_WINDOW_HPP
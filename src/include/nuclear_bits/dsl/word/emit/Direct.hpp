@@ -54,8 +54,9 @@ namespace dsl {
 
                 static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
 
-                    // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    // Run all our reactions that are interested (from a snapshot so they can be unbound while we run)
+                    auto reactions = store::TypeCallbackStore<DataType>::get();
+                    for (auto& reaction : *reactions) {
                         try {
 
                             // Set our thread local store data each time (as during direct it can be overwritten)
@@ -0,0 +1,98 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_DSL_WORD_EMIT_INLINE_HPP
+#define NUCLEAR_DSL_WORD_EMIT_INLINE_HPP
+
+#include "nuclear_bits/PowerPlant.hpp"
+#include "nuclear_bits/dsl/store/DataStore.hpp"
+#include "nuclear_bits/dsl/store/ThreadStore.hpp"
+#include "nuclear_bits/dsl/store/TypeCallbackStore.hpp"
+
+namespace NUClear {
+namespace dsl {
+    namespace word {
+        namespace emit {
+
+            /**
+             * @brief
+             *  When emitting data under this scope, reactions that are marked as Inline are executed immediately and
+             *  all other reactions are distributed via the thread pool.
+             *
+             * @details
+             *  @code emit<Scope::INLINE>(data, dataType); @endcode
+             *  Cheap reactions that are marked with the Inline word will pause the current task and run sequentially
+             *  using the current thread, like Scope::DIRECT. Any other reactions will be given to the thread pool like
+             *  Scope::LOCAL, so expensive reactions can not add latency to the emitter.
+             *
+             * @attention
+             *  Reactions that are given to the thread pool will not run once the system has shutdown.
+             *
+             * @param data
+             *  the data to emit
+             * @tparam DataType
+             *  the datatype that is being emitted
+             */
+            template <typename DataType>
+            struct Inline {
+
+                static void emit(PowerPlant& powerplant, std::shared_ptr<DataType> data) {
+
+                    // Run all our reactions that are interested (from a snapshot so they can be unbound while we run)
+                    auto reactions = store::TypeCallbackStore<DataType>::get();
+                    for (auto& reaction : *reactions) {
+                        try {
+
+                            // Set our thread local store data each time (as inline reactions can overwrite it)
+                            store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
+
+                            auto task = reaction->get_task();
+                            if (task) {
+                                // Cheap reactions run here, everything else goes to the thread pool
+                                if (reaction->run_inline) {
+                                    task = task->run(std::move(task));
+                                }
+                                else {
+                                    powerplant.submit(std::move(task));
+                                }
+                            }
+                        }
+                        catch (const std::exception& ex) {
+                            powerplant.log<NUClear::ERROR>("There was an exception while generating a reaction",
+                                                           ex.what());
+                        }
+                        catch (...) {
+                            powerplant.log<NUClear::ERROR>(
+                                "There was an unknown exception while generating a reaction");
+                        }
+                    }
+
+                    // Unset our thread local store data
+                    store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
+
+                    // Set the data into the global store
+                    store::DataStore<DataType>::set(data);
+                }
+            };
+
+        }  // namespace emit
+    }      // namespace word
+}  // namespace dsl
+}  // namespace NUClear
+
+#endif  // NUCLEAR_DSL_WORD_EMIT_INLINE_HPP
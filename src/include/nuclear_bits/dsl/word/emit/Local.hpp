@@ -35,6 +35,8 @@ namespace dsl {
              *
              * @details
              *  @code emit<Scope::LOCAL>(data, dataType); @endcode
+             *  A vector of data can also be emitted, in which case the tasks for every element are submitted to the
+             *  thread pool together.
              *
              * @attention
              *  Note that this type of emission is the default behaviour when emitting without a specified scope.
@@ -53,8 +55,9 @@ namespace dsl {
                     // Set our thread local store data
                     store::ThreadStore<std::shared_ptr<DataType>>::value = &data;
 
-                    // Run all our reactions that are interested
-                    for (auto& reaction : store::TypeCallbackStore<DataType>::get()) {
+                    // Run all our reactions that are interested (from a snapshot so they can be unbound while we run)
+                    auto reactions = store::TypeCallbackStore<DataType>::get();
+                    for (auto& reaction : *reactions) {
                         try {
                             auto task = reaction->get_task();
                             if (task) {
@@ -78,6 +81,51 @@ namespace dsl {
                     // Set the data into the global store
                     store::DataStore<DataType>::set(data);
                 }
+
+                static void emit(PowerPlant& powerplant, std::vector<std::shared_ptr<DataType>>& data) {
+
+                    // Collect the tasks for every element so they can be submitted together
+                    std::vector<std::unique_ptr<threading::ReactionTask>> tasks;
+
+                    // Take a snapshot of the reactions so they can be bound and unbound while we use them
+                    auto reactions = store::TypeCallbackStore<DataType>::get();
+
+                    for (auto& d : data) {
+
+                        // Set our thread local store data
+                        store::ThreadStore<std::shared_ptr<DataType>>::value = &d;
+
+                        // Make the tasks for all our reactions that are interested
+                        for (auto& reaction : *reactions) {
+                            try {
+                                auto task = reaction->get_task();
+                                if (task) {
+                                    tasks.push_back(std::move(task));
+                                }
+                            }
+                            // If there is an exception while generating a reaction print it here
+                            catch (const std::exception& ex) {
+                                powerplant.log<NUClear::ERROR>("There was an exception while generating a reaction",
+                                                               ex.what());
+                            }
+                            catch (...) {
+                                powerplant.log<NUClear::ERROR>(
+                                    "There was an unknown exception while generating a reaction");
+                            }
+                        }
+
+                        // Unset our thread local store data
+                        store::ThreadStore<std::shared_ptr<DataType>>::value = nullptr;
+
+                        // Set the data into the global store so the next element sees it like a normal emit would
+                        store::DataStore<DataType>::set(d);
+                    }
+
+                    // Give all the tasks to the thread pool at once
+                    if (!tasks.empty()) {
+                        powerplant.submit(std::move(tasks));
+                    }
+                }
             };
 
         }  // namespace emit
@@ -19,6 +19,8 @@
 #ifndef NUCLEAR_EXTENSION_CHRONOCONTROLLER
 #define NUCLEAR_EXTENSION_CHRONOCONTROLLER
 
+#include <unordered_set>
+
 #include "nuclear"
 
 namespace NUClear {
@@ -29,11 +31,38 @@ namespace extension {
         explicit ChronoController(std::unique_ptr<NUClear::Environment> environment);
 
     private:
+        /// @brief drop unbound tasks from the heap once there are enough of them to be worth the O(n) cost
+        void compact();
+
+        /// @brief update our spin window from how late we woke up after waiting
+        void calibrate(const NUClear::clock::duration& latency);
+
+        /// @brief run all the tasks that are due, recording how late they were
+        void run_due_tasks();
+
+        /// @brief the tasks that are waiting to run, kept as a heap with the soonest task at the front
         std::vector<dsl::operation::ChronoTask> tasks;
+        /// @brief the ids of tasks that have been unbound, they are dropped when they reach the front of the heap
+        std::unordered_set<uint64_t> cancelled;
         std::mutex mutex;
         std::condition_variable wait;
 
+        /// @brief how long before a task is due we stop waiting and spin, so the wake up latency doesn't make us late
         NUClear::clock::duration wait_offset;
+        /// @brief the longest we will ever spin for (the configured timer spin, or zero on single CPU systems)
+        NUClear::clock::duration max_wait_offset;
+        /// @brief a running average of how late our thread wakes up after a timed wait
+        NUClear::clock::duration wake_latency;
+        /// @brief how late we will run a task so the tasks due soon after it can share its wake up
+        NUClear::clock::duration slack;
+
+        /// @brief the statistics for the tasks run since we last emitted them
+        struct {
+            uint64_t tasks = 0;
+            NUClear::clock::duration total_lateness{0};
+            NUClear::clock::duration max_lateness{0};
+            NUClear::clock::time_point last_report = NUClear::clock::now();
+        } stats;
     };
 
 }  // namespace extension
@@ -19,8 +19,10 @@
 #ifndef NUCLEAR_EXTENSION_IOCONTROLLER
 #define NUCLEAR_EXTENSION_IOCONTROLLER
 
-#ifdef _WIN32
+#if defined(_WIN32)
 #include "IOController_Windows.hpp"
+#elif defined(__linux__)
+#include "IOController_Epoll.hpp"
 #else
 #include "IOController_Posix.hpp"
 #endif  // _WIN32
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_EXTENSION_IOCONTROLLER_EPOLL_HPP
+#define NUCLEAR_EXTENSION_IOCONTROLLER_EPOLL_HPP
+
+#include "nuclear"
+#include "nuclear_bits/dsl/word/IO.hpp"
+
+#include <sys/epoll.h>
+#include <unistd.h>
+
+#include <unordered_map>
+
+namespace NUClear {
+namespace extension {
+
+    class IOController : public Reactor {
+    private:
+        struct Task {
+            Task(short events, const std::shared_ptr<threading::Reaction>& reaction)
+                : events(events), reaction(reaction) {}
+
+            short events;
+            std::shared_ptr<threading::Reaction> reaction;
+        };
+
+        /// @brief everything that is watching a single fd, epoll gives us a pointer to this when the fd has events
+        struct Watch {
+            explicit Watch(fd_t fd) : fd(fd) {}
+
+            /// @brief the fd being watched
+            fd_t fd;
+            /// @brief the reactions that are watching this fd
+            std::vector<Task> tasks;
+        };
+
+    public:
+        explicit IOController(std::unique_ptr<NUClear::Environment> environment);
+
+    private:
+        /// @brief update the events epoll watches for a fd (removing it if nothing is watching anymore)
+        void update(std::shared_ptr<Watch> watch);
+
+        /// @brief the epoll instance that watches all our fds
+        fd_t epoll_fd;
+        /// @brief an eventfd that we use to wake up epoll_wait
+        fd_t notify_fd;
+
+        bool shutdown = false;
+        std::mutex reaction_mutex;
+        /// @brief the watches for each fd
+        std::unordered_map<fd_t, std::shared_ptr<Watch>> watches;
+        /// @brief which fd each reaction is watching so it can be unbound
+        std::unordered_map<uint64_t, fd_t> reaction_fds;
+        /// @brief watches that were removed but could still be in the events from the last epoll_wait
+        std::vector<std::shared_ptr<Watch>> retired;
+    };
+
+}  // namespace extension
+}  // namespace NUClear
+
+#endif  // NUCLEAR_EXTENSION_IOCONTROLLER_EPOLL_HPP
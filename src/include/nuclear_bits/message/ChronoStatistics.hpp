@@ -0,0 +1,66 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_CHRONOSTATISTICS_HPP
+#define NUCLEAR_MESSAGE_CHRONOSTATISTICS_HPP
+
+#include <cstdint>
+
+#include "nuclear_bits/clock.hpp"
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Holds details about how accurately timed tasks (such as Every and delayed emits) are being run.
+     *
+     * @details This is emitted by the ChronoController about once a second while it has been running timed tasks,
+     *          and covers the tasks that ran since the last one was emitted.
+     */
+    struct ChronoStatistics {
+
+        ChronoStatistics()
+            : tasks(0), mean_lateness(0), max_lateness(0), wake_latency(0), spin_window(0) {}
+
+        ChronoStatistics(uint64_t tasks,
+                         const clock::duration& mean_lateness,
+                         const clock::duration& max_lateness,
+                         const clock::duration& wake_latency,
+                         const clock::duration& spin_window)
+            : tasks(tasks)
+            , mean_lateness(mean_lateness)
+            , max_lateness(max_lateness)
+            , wake_latency(wake_latency)
+            , spin_window(spin_window) {}
+
+        /// @brief The number of timed tasks that were run
+        uint64_t tasks;
+        /// @brief The average time between when a task should have run and when it did
+        clock::duration mean_lateness;
+        /// @brief The longest time between when a task should have run and when it did
+        clock::duration max_lateness;
+        /// @brief How late the controller measures its thread waking up after a wait, on average
+        clock::duration wake_latency;
+        /// @brief How long before a task is due the controller wakes up and spins to be on time
+        clock::duration spin_window;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_CHRONOSTATISTICS_HPP
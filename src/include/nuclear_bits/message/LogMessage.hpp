@@ -19,6 +19,9 @@
 #ifndef NUCLEAR_MESSAGE_LOGMESSAGE_HPP
 #define NUCLEAR_MESSAGE_LOGMESSAGE_HPP
 
+#include <memory>
+#include <string>
+
 #include "nuclear_bits/LogLevel.hpp"
 #include "nuclear_bits/message/ReactionStatistics.hpp"
 
@@ -37,8 +40,9 @@ namespace message {
         /// @brief The string contents of the message.
         std::string message;
 
-        /// @brief The currently executing task that made this message
-        const ReactionStatistics* task;
+        /// @brief The statistics of the task that made this message (or nullptr if it was not made by a task), these
+        /// are shared with the task so they can be kept after it has finished
+        std::shared_ptr<const ReactionStatistics> task;
     };
 
 }  // namespace message
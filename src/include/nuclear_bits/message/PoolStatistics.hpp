@@ -0,0 +1,53 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_MESSAGE_POOLSTATISTICS_HPP
+#define NUCLEAR_MESSAGE_POOLSTATISTICS_HPP
+
+#include <cstdint>
+#include <string>
+
+namespace NUClear {
+namespace message {
+
+    /**
+     * @brief Holds details about how well an object pool is reusing its objects.
+     *
+     * @details This is emitted each time a pool has to allocate a new object because it had none to reuse.
+     */
+    struct PoolStatistics {
+
+        PoolStatistics() : type(), hits(0), misses(0), high_water(0) {}
+
+        PoolStatistics(std::string type, uint64_t hits, uint64_t misses, uint64_t high_water)
+            : type(std::move(type)), hits(hits), misses(misses), high_water(high_water) {}
+
+        /// @brief The name of the type of object that the pool holds
+        std::string type;
+        /// @brief The number of objects that were reused from the pool
+        uint64_t hits;
+        /// @brief The number of objects that had to be allocated because the pool was empty
+        uint64_t misses;
+        /// @brief The most objects that have been taken from the pool and not yet given back at once
+        uint64_t high_water;
+    };
+
+}  // namespace message
+}  // namespace NUClear
+
+#endif  // NUCLEAR_MESSAGE_POOLSTATISTICS_HPP
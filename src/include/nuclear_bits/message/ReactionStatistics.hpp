@@ -19,6 +19,7 @@
 #ifndef NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 #define NUCLEAR_MESSAGE_REACTIONSTATISTICS_HPP
 
+#include <exception>
 #include <string>
 #include <vector>
 
@@ -90,6 +90,12 @@ namespace threading {
         /// @brief if this reaction object is currently enabled
         std::atomic<bool> enabled;
 
+        /// @brief how many tasks this reaction can have at once, once it has this many it won't make any more
+        std::atomic<int> max_active_tasks;
+
+        /// @brief if this is true the reaction is cheap enough to run in the emitting thread for Scope::INLINE
+        bool run_inline;
+
         /// @brief list of functions to use to unbind the reaction and clean
         std::vector<std::function<void(Reaction&)>> unbinders;
 
@@ -20,12 +20,14 @@
 #define NUCLEAR_THREADING_REACTIONTASK_HPP
 
 #include <atomic>
+#include <exception>
 #include <functional>
 #include <memory>
 #include <typeindex>
 #include <vector>
 
 #include "nuclear_bits/message/ReactionStatistics.hpp"
+#include "nuclear_bits/util/InlineFunction.hpp"
 #include "nuclear_bits/util/platform.hpp"
 
 namespace NUClear {
@@ -40,6 +42,9 @@ namespace threading {
      * @details
      *  This class holds a reaction that is ready to be executed. It is a Reaction object which has had it's callback
      *  parameters bound with data. This can then be executed as a function to run the call inside it.
+     *
+     *  ReactionTasks are created and destroyed at a very high rate, so rather than returning their memory to the heap
+     *  thread pool threads keep a list of freed ReactionTasks that they reuse when they next create one.
      */
     class ReactionTask {
     private:
@@ -49,9 +54,16 @@ namespace threading {
         /// @brief the current task that is being executed by this thread (or nullptr if none is)
         static ATTRIBUTE_TLS ReactionTask* current_task;
 
+        /// @brief the task that this thread will run when the current task has finished (or nullptr if there is none)
+        static ATTRIBUTE_TLS ReactionTask* next_task;
+
     public:
+        /// @brief the number of reactions bound to Trigger<ReactionStatistics>, statistics are only emitted while this
+        /// is not zero
+        static std::atomic<unsigned int> statistics_listeners;
+
         /// Type of the functions that ReactionTasks execute
-        using TaskFunction = std::function<std::unique_ptr<ReactionTask>(std::unique_ptr<ReactionTask>&&)>;
+        using TaskFunction = util::InlineFunction<std::unique_ptr<ReactionTask>(std::unique_ptr<ReactionTask>&&)>;
 
         /**
          * @brief Gets the current executing task, or nullptr if there isn't one.
@@ -69,6 +81,57 @@ namespace threading {
          */
         ReactionTask(Reaction& parent, int priority, TaskFunction&& callback);
 
+        /**
+         * @brief Allocates memory for a ReactionTask, reusing a previously freed task from this thread if possible.
+         */
+        static void* operator new(std::size_t size);
+
+        /**
+         * @brief Frees the memory of a ReactionTask by keeping it for reuse by this thread if it keeps a free list.
+         */
+        static void operator delete(void* ptr, std::size_t size);
+
+        /**
+         * @brief Makes this thread keep the memory of the ReactionTasks it frees so it can reuse it.
+         *
+         * @details
+         *  Other threads (such as the chrono and IO threads) give the memory straight back to the heap. A thread that
+         *  calls this must call release_free_list before it exits, otherwise the memory it is keeping will be leaked.
+         */
+        static void use_free_list();
+
+        /**
+         * @brief Returns all of the ReactionTask memory this thread is keeping for reuse to the heap.
+         *
+         * @details
+         *  This also stops the thread keeping any more freed ReactionTasks.
+         */
+        static void release_free_list();
+
+        /**
+         * @brief Gives a task to the current thread to run as soon as the task it is running now has finished.
+         *
+         * @details
+         *  This lets a task pass work on to be run on the same thread without going back through the thread pool
+         *  (for example to run the next task in a Sync group). Running it after the current task has finished,
+         *  rather than straight away, stops long chains of tasks from growing the stack.
+         *
+         * @param task the task to run next, this is left alone if the thread already has a task to run next
+         *
+         * @return true if the thread took the task, false if it already had a task to run next
+         */
+        static bool run_next(std::unique_ptr<ReactionTask>&& task);
+
+        /// @brief the times that this task went through each stage of its life
+        struct Timing {
+            /// @brief the time that this task was emitted to the thread pool
+            clock::time_point emitted;
+            /// @brief the time that execution started on this task
+            clock::time_point started;
+            /// @brief the time that execution finished on this task
+            clock::time_point finished;
+        };
+
         /**
          * @brief Runs the internal data bound task and times it.
          *
@@ -78,14 +141,40 @@ namespace threading {
          */
         std::unique_ptr<ReactionTask> run(std::unique_ptr<ReactionTask>&& us);
 
+        /**
+         * @brief Creates a statistics object from the timing of this task so far.
+         *
+         * @return a new statistics object for this task
+         */
+        std::unique_ptr<message::ReactionStatistics> make_stats() const;
+
+        /**
+         * @brief Gets the statistics for this task as they were the first time this was called.
+         *
+         * @details
+         *  The statistics are made the first time they are asked for and then kept for the life of the task, so
+         *  things that want them often while the task runs (such as logging) only make them once.
+         *
+         * @return the statistics for this task
+         */
+        std::shared_ptr<const message::ReactionStatistics> get_stats() const;
+
         /// @brief the parent Reaction object which spawned this
         Reaction& parent;
         /// @brief the task id of this task (the sequence number of this particular task)
         uint64_t id;
+        /// @brief the reaction id of the reaction that caused this task or 0 if there was not one
+        uint64_t cause_reaction_id;
+        /// @brief the task id of the task that caused this task or 0 if there was not one
+        uint64_t cause_task_id;
         /// @brief the priority to run this task at
         int priority;
-        /// @brief the statistics object that persists after this for information and debugging
-        std::unique_ptr<message::ReactionStatistics> stats;
+        /// @brief when this task was emitted, started and finished
+        Timing timing;
+        /// @brief the exception that this task threw when it ran or nullptr if it did not throw one
+        std::exception_ptr exception;
+        /// @brief the statistics that get_stats made for this task, this is nullptr until they are asked for
+        mutable std::shared_ptr<const message::ReactionStatistics> stats;
         /// @brief if these stats are safe to emit. It should start true, and as soon as we are a reaction based on
         /// reaction statistics becomes false for all created tasks. This is to stop infinite loops of death.
         bool emit_stats;
@@ -108,8 +197,7 @@ namespace threading {
         // If we ever have a null pointer, we move it to the top of the queue as it is being removed
         return a == nullptr ? false
                             : b == nullptr ? true
-                                           : a->priority == b->priority ? a->stats->emitted > b->stats->emitted
-                                                                        : a->priority < b->priority;
+                                           : a->priority == b->priority ? a->id > b->id : a->priority < b->priority;
     }
 
 }  // namespace threading
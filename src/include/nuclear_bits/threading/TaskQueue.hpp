@@ -0,0 +1,172 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_THREADING_TASKQUEUE_HPP
+#define NUCLEAR_THREADING_TASKQUEUE_HPP
+
+#include <atomic>
+#include <cstdint>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <queue>
+#include <vector>
+
+#include "ReactionTask.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    /**
+     * @brief A lock free priority queue for ReactionTasks that is safe to use from any number of threads.
+     *
+     * @details
+     *  Almost every task in the system runs at one of the five Priority levels (REALTIME, HIGH, NORMAL, LOW and IDLE)
+     *  so rather than sorting every task in a heap, this queue keeps a bounded lock free ring buffer for each of
+     *  these levels. Pushing and popping a task is then a constant time operation that does not take a lock. Tasks
+     *  with a custom priority, or tasks that arrive when the ring for their priority is full, are placed in an
+     *  overflow heap that is protected by a mutex. Once a priority has overflowed, new tasks of that priority also go
+     *  to the overflow heap until it has none of them left.
+     *
+     *  Tasks with a higher priority are always removed first. Tasks of the same priority are removed in the order
+     *  that they were pushed.
+     */
+    class TaskQueue {
+    public:
+        /// @brief the value of priority() when there are no tasks in the queue
+        static constexpr int EMPTY = std::numeric_limits<int>::min();
+
+        /**
+         * @brief Constructs a new empty TaskQueue.
+         *
+         * @param capacity the number of tasks each priority ring can hold before tasks overflow (a power of two)
+         */
+        explicit TaskQueue(size_t capacity = 1024);
+        ~TaskQueue();
+
+        TaskQueue(const TaskQueue&) = delete;
+        TaskQueue& operator=(const TaskQueue&) = delete;
+
+        /**
+         * @brief Adds a task to the queue.
+         *
+         * @param task the task to add
+         */
+        void push(std::unique_ptr<ReactionTask>&& task);
+
+        /**
+         * @brief Removes the highest priority task from the queue.
+         *
+         * @return the removed task, or nullptr if the queue was empty
+         */
+        std::unique_ptr<ReactionTask> pop();
+
+        /**
+         * @brief Gets the priority of the next task that would be removed from this queue.
+         *
+         * @details
+         *  This does not take any locks. When other threads are modifying the queue the result may already be out of
+         *  date, however once a push has returned it is guaranteed to be seen by this function.
+         *
+         * @return the priority of the next task, or EMPTY if there are no tasks in the queue
+         */
+        int priority() const;
+
+    private:
+        /**
+         * @brief A bounded multiple producer, multiple consumer lock free ring buffer.
+         */
+        class Ring {
+        public:
+            Ring(size_t capacity);
+
+            /**
+             * @brief Adds a task to the back of the ring.
+             *
+             * @return true if the task was added, false if the ring was full
+             */
+            bool push(ReactionTask* task);
+
+            /**
+             * @brief Removes the task at the front of the ring.
+             *
+             * @return the task, or nullptr if the ring was empty
+             */
+            ReactionTask* pop();
+
+            /**
+             * @brief If there is currently no task ready to be removed from the ring
+             */
+            bool empty() const;
+
+        private:
+            struct Cell {
+                /// @brief the position in the ring that this cell is ready to be written (or read) for
+                std::atomic<size_t> sequence;
+                /// @brief the task stored in this cell
+                ReactionTask* task;
+            };
+
+            /// @brief the mask to convert a position into an index in the cells
+            const size_t mask;
+            /// @brief the cells that make up the ring
+            std::unique_ptr<Cell[]> cells;
+            /// @brief the position that the next task will be written to
+            alignas(64) std::atomic<size_t> tail;
+            /// @brief the position that the next task will be read from
+            alignas(64) std::atomic<size_t> head;
+        };
+
+        /**
+         * @brief Gets the ring that holds tasks of the given priority.
+         *
+         * @return the index of the ring for this priority, or -1 if this priority does not have its own ring
+         */
+        static int bucket(int priority);
+
+        /**
+         * @brief Removes the top task from the overflow queue.
+         *
+         * @details
+         *  The overflow mutex must be held and the overflow queue must not be empty.
+         *
+         * @return the removed task
+         */
+        std::unique_ptr<ReactionTask> pop_overflow();
+
+        /// @brief the priority of the tasks held in each of our rings, from highest to lowest
+        static const int priorities[];
+
+        /// @brief a ring for each of our standard priority levels, ordered from highest to lowest priority
+        std::vector<std::unique_ptr<Ring>> rings;
+
+        /// @brief the mutex that protects our overflow queue
+        std::mutex overflow_mutex;
+        /// @brief the tasks that did not fit into one of our rings
+        std::priority_queue<std::unique_ptr<ReactionTask>> overflow;
+        /// @brief the priority of the top of the overflow queue, or EMPTY if it is empty
+        std::atomic<int> overflow_priority;
+        /// @brief how many tasks of each ring's priority are in the overflow queue, while there are any new tasks of
+        /// that priority also go to the overflow queue so they are not run before the older ones
+        std::unique_ptr<std::atomic<size_t>[]> overflowed;
+    };
+
+}  // namespace threading
+}  // namespace NUClear
+
+#endif  // NUCLEAR_THREADING_TASKQUEUE_HPP
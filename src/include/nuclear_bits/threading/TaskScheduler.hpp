@@ -25,10 +25,12 @@
 #include <map>
 #include <memory>
 #include <mutex>
-#include <queue>
+#include <thread>
 #include <typeindex>
 #include <vector>
 #include "Reaction.hpp"
+#include "TaskQueue.hpp"
+#include "nuclear_bits/util/platform.hpp"
 
 namespace NUClear {
 namespace threading {
@@ -61,13 +63,36 @@ namespace threading {
      *  @code Single @endcode
      *  If single is encountered while processing the function, and a Task object for this Reaction is already running
      *  in a thread, or waiting in the Queue, then this task is ignored and dropped from the system.
+     *
+     *  @em Work Stealing
+     *  When work stealing is enabled each pool thread owns its own priority queue. Tasks that are submitted from
+     *  inside a running reaction are placed on the local queue of the thread that submitted them, while tasks from
+     *  other threads go to a shared queue. When a thread looks for work it takes the highest priority task that is
+     *  advertised by its own queue, the shared queue or any other threads queue (stealing it). This keeps priority
+     *  ordering across the pool while avoiding a single lock that every submission and every thread contends on.
+     *  If a NUMA layout is given, threads steal from threads on their own node before threads on other nodes.
+     *
+     *  @em Idle Threads
+     *  When a thread cannot find a task it first spins checking the queues, then yields to the OS, and only then goes
+     *  to sleep. Submitting a task only wakes a thread when one is actually asleep, so bursts of small tasks are
+     *  picked up by threads that are still spinning without paying for a wakeup.
      */
     class TaskScheduler {
     public:
         /**
          * @brief Constructs a new TaskScheduler instance, and builds the nullptr sync queue.
+         *
+         * @param thread_count  the number of threads that will be taking tasks from this scheduler
+         * @param work_stealing if each of these threads should own a local queue that other threads can steal from
+         * @param spin_count    how many times an idle thread checks for tasks before it starts yielding
+         * @param yield_count   how many times an idle thread yields before it goes to sleep
+         * @param numa_nodes    the CPUs in each NUMA node, used so threads prefer stealing from their own node
          */
-        TaskScheduler();
+        TaskScheduler(size_t thread_count                             = 1,
+                      bool work_stealing                              = false,
+                      size_t spin_count                               = 0,
+                      size_t yield_count                              = 0,
+                      const std::vector<std::vector<int>>& numa_nodes = {});
 
         /**
          * @brief
@@ -88,6 +113,17 @@ namespace threading {
          */
         void submit(std::unique_ptr<ReactionTask>&& task);
 
+        /**
+         * @brief Submit a batch of new tasks to be executed to the Scheduler.
+         *
+         * @details
+         *  The tasks are queued in the order they are given, and then waiting threads are woken once for the whole
+         *  batch rather than once for each task.
+         *
+         * @param tasks the tasks to be executed
+         */
+        void submit(std::vector<std::unique_ptr<ReactionTask>>&& tasks);
+
         /**
          * @brief Get a task object to be executed by a thread.
          *
@@ -100,12 +136,61 @@ namespace threading {
          */
         std::unique_ptr<ReactionTask> get_task();
 
+        /**
+         * @brief Checks if the calling thread is one of the threads that takes tasks from this scheduler.
+         *
+         * @return true if the calling thread has taken tasks from this scheduler
+         */
+        bool is_current_thread() const;
+
     private:
+        /**
+         * @brief Gets the local queue owned by the calling thread, claiming one if this thread does not have one yet.
+         *
+         * @return the calling threads local queue, or nullptr if it does not have one
+         */
+        TaskQueue* local_queue();
+
+        /**
+         * @brief Finds the queue that is advertising the highest priority task.
+         *
+         * @details
+         *  The local queue is preferred when priorities are equal so that threads keep working on tasks that they
+         *  created, then the shared queue, then the queues of other threads on the same NUMA node, and finally the
+         *  queues of threads on other NUMA nodes.
+         *
+         * @param local the calling threads local queue (or nullptr if it has none)
+         *
+         * @return the queue with the highest priority task, or nullptr if every queue is empty
+         */
+        TaskQueue* best_queue(TaskQueue* local);
+
+        /// @brief the scheduler that owns the current threads local queue
+        static ATTRIBUTE_TLS TaskScheduler* current_scheduler;
+        /// @brief the local queue that is owned by the current thread
+        static ATTRIBUTE_TLS TaskQueue* current_queue;
+        /// @brief the NUMA node of the current thread's local queue
+        static ATTRIBUTE_TLS int current_node;
+
         /// @brief if the scheduler is running or is shut down
         volatile bool running;
-        /// @brief our queue which sorts tasks by priority
-        std::priority_queue<std::unique_ptr<ReactionTask>> queue;
-        /// @brief the mutex which our threads synchronize their access to this object
+        /// @brief the queue for tasks that are not submitted by one of our threads
+        TaskQueue queue;
+        /// @brief the local queues for each of our threads, this is empty if we are not work stealing
+        std::vector<std::unique_ptr<TaskQueue>> local_queues;
+        /// @brief the NUMA node of the thread that owns each local queue
+        std::unique_ptr<std::atomic<int>[]> local_queue_nodes;
+        /// @brief the index of the next local queue to be claimed by a thread
+        std::atomic<size_t> next_local_queue;
+        /// @brief the CPUs that are in each NUMA node
+        const std::vector<std::vector<int>> numa_nodes;
+        /// @brief how many times an idle thread checks for tasks before it starts yielding
+        const size_t spin_count;
+        /// @brief how many times an idle thread yields before it goes to sleep
+        const size_t yield_count;
+        /// @brief the number of threads that are asleep (or about to be) waiting on the condition
+        std::atomic<int> sleeping;
+        /// @brief the mutex which our threads synchronize on when they are waiting for a task
         std::mutex mutex;
         /// @brief the condition object that threads wait on if they can't get a task
         std::condition_variable condition;
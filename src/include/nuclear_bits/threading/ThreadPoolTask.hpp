@@ -21,27 +21,42 @@
 
 #include "nuclear_bits/PowerPlant.hpp"
 #include "nuclear_bits/threading/TaskScheduler.hpp"
+#include "nuclear_bits/util/set_current_thread_affinity.hpp"
 #include "nuclear_bits/util/update_current_thread_priority.hpp"
 
 namespace NUClear {
 namespace threading {
 
-    inline std::function<void()> make_thread_pool_task(PowerPlant& powerplant, TaskScheduler& scheduler) {
-        return [&powerplant, &scheduler] {
+    inline std::function<void()> make_thread_pool_task(PowerPlant& powerplant,
+                                                       TaskScheduler& scheduler,
+                                                       const std::vector<int>& cpus = {}) {
+        return [&powerplant, &scheduler, cpus] {
+
+            // Pin ourselves to our CPUs before we take any tasks
+            set_current_thread_affinity(cpus);
 
             // Wait at a high (but not realtime) priority to reduce latency
             // for picking up a new task
             update_current_thread_priority(1000);
 
+            // Keep the memory of the tasks we free so we can reuse it, we give it back when we finish
+            ReactionTask::use_free_list();
+
             // Run while our scheduler gives us tasks
             for (std::unique_ptr<ReactionTask> task(scheduler.get_task()); task; task = scheduler.get_task()) {
 
                 // Run the task
                 task = task->run(std::move(task));
 
-                // Back up to realtime while waiting
-                update_current_thread_priority(1000);
+                // Free the task now so its memory can be reused by the next task this thread creates
+                task.reset();
+
+                // We stay at the priority of the last task while we look for the next one, resetting it here would
+                // cost a system call for every task. The scheduler resets it before this thread goes to sleep
             }
+
+            // We are done with the tasks so give back the memory we kept for reuse
+            ReactionTask::release_free_list();
         };
     }
 
@@ -20,7 +20,7 @@
 #define NUCLEAR_UTIL_CALLBACKGENERATOR_HPP
 
 #include "nuclear_bits/dsl/trait/is_transient.hpp"
-#include "nuclear_bits/dsl/word/emit/Direct.hpp"
+#include "nuclear_bits/dsl/word/emit/Inline.hpp"
 #include "nuclear_bits/util/MergeTransient.hpp"
 #include "nuclear_bits/util/TransientDataElements.hpp"
 #include "nuclear_bits/util/apply.hpp"
@@ -90,8 +90,9 @@ namespace util {
                 }
 
                 // We have to make a copy of the callback because the "this" variable can go out of scope
-                auto c = callback;
-                return std::make_pair(DSL::priority(r), [c, data](std::unique_ptr<threading::ReactionTask>&& task) {
+                // The data is moved into the task so it is not copied again when the task runs
+                return std::make_pair(DSL::priority(r), [c = callback, data = std::move(data)](
+                                                            std::unique_ptr<threading::ReactionTask>&& task) mutable {
 
                     // Check if we are going to reschedule
                     task = DSL::reschedule(std::move(task));
@@ -103,7 +104,7 @@ namespace util {
                         update_current_thread_priority(task->priority);
 
                         // Record our start time
-                        task->stats->started = clock::now();
+                        task->timing.started = clock::now();
 
                         // We have to catch any exceptions
                         try {
@@ -113,11 +114,11 @@ namespace util {
                         catch (...) {
 
                             // Catch our exception if it happens
-                            task->stats->exception = std::current_exception();
+                            task->exception = std::current_exception();
                         }
 
                         // Our finish time
-                        task->stats->finished = clock::now();
+                        task->timing.finished = clock::now();
 
                         // Run our postconditions
                         DSL::postcondition(*task);
@@ -125,9 +126,11 @@ namespace util {
                         // Take one from our active tasks
                         --task->parent.active_tasks;
 
-                        // Emit our reaction statistics if it wouldn't cause a loop
-                        if (task->emit_stats) {
-                            PowerPlant::powerplant->emit<dsl::word::emit::Direct>(task->stats);
+                        // Emit our reaction statistics if someone is listening, it wouldn't cause a loop and we haven't
+                        // shutdown
+                        if (task->emit_stats && threading::ReactionTask::statistics_listeners > 0
+                            && PowerPlant::powerplant) {
+                            PowerPlant::powerplant->emit<dsl::word::emit::Inline>(task->make_stats());
                         }
                     }
 
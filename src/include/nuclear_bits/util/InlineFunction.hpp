@@ -0,0 +1,190 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_INLINEFUNCTION_HPP
+#define NUCLEAR_UTIL_INLINEFUNCTION_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace NUClear {
+namespace util {
+
+    template <typename Signature, size_t Size = 64>
+    class InlineFunction;
+
+    /**
+     * @brief A move only function wrapper that stores small callables inside itself rather than on the heap.
+     *
+     * @details
+     *  This works like std::function except that it can't be copied, and any callable that fits in Size bytes is
+     *  stored directly inside the wrapper. Larger callables (or ones that may throw when moved) fall back to being
+     *  allocated on the heap.
+     *
+     * @tparam R    the return type of the function
+     * @tparam Args the argument types of the function
+     * @tparam Size the number of bytes of inline storage
+     */
+    template <typename R, typename... Args, size_t Size>
+    class InlineFunction<R(Args...), Size> {
+    private:
+        using Storage = typename std::aligned_storage<Size, alignof(std::max_align_t)>::type;
+
+        /// @brief the functions used to manage the callable that is currently stored
+        struct Operations {
+            R (*invoke)(Storage&, Args...);
+            void (*move)(Storage& from, Storage& to);
+            void (*destroy)(Storage&);
+        };
+
+        /// @brief manages a callable that is stored inside our storage
+        template <typename F>
+        struct Inline {
+            static F& get(Storage& s) {
+                return *reinterpret_cast<F*>(&s);
+            }
+
+            template <typename Func>
+            static void create(Storage& s, Func&& f) {
+                new (&s) F(std::forward<Func>(f));
+            }
+
+            static R invoke(Storage& s, Args... args) {
+                return get(s)(std::forward<Args>(args)...);
+            }
+
+            static void move(Storage& from, Storage& to) {
+                new (&to) F(std::move(get(from)));
+                get(from).~F();
+            }
+
+            static void destroy(Storage& s) {
+                get(s).~F();
+            }
+
+            static const Operations* operations() {
+                static const Operations ops = {&invoke, &move, &destroy};
+                return &ops;
+            }
+        };
+
+        /// @brief manages a callable that is too big for our storage and so lives on the heap
+        template <typename F>
+        struct Heap {
+            static F*& get(Storage& s) {
+                return *reinterpret_cast<F**>(&s);
+            }
+
+            template <typename Func>
+            static void create(Storage& s, Func&& f) {
+                new (&s) F*(new F(std::forward<Func>(f)));
+            }
+
+            static R invoke(Storage& s, Args... args) {
+                return (*get(s))(std::forward<Args>(args)...);
+            }
+
+            static void move(Storage& from, Storage& to) {
+                new (&to) F*(get(from));
+            }
+
+            static void destroy(Storage& s) {
+                delete get(s);
+            }
+
+            static const Operations* operations() {
+                static const Operations ops = {&invoke, &move, &destroy};
+                return &ops;
+            }
+        };
+
+        template <typename F>
+        using Manager = typename std::conditional<sizeof(F) <= Size && alignof(F) <= alignof(std::max_align_t)
+                                                      && std::is_nothrow_move_constructible<F>::value,
+                                                  Inline<F>,
+                                                  Heap<F>>::type;
+
+    public:
+        InlineFunction() noexcept : ops(nullptr) {}
+
+        InlineFunction(std::nullptr_t) noexcept : ops(nullptr) {}
+
+        template <typename F,
+                  typename = typename std::enable_if<!std::is_same<typename std::decay<F>::type,
+                                                                   InlineFunction>::value>::type>
+        InlineFunction(F&& f) : ops(Manager<typename std::decay<F>::type>::operations()) {
+            Manager<typename std::decay<F>::type>::create(storage, std::forward<F>(f));
+        }
+
+        InlineFunction(InlineFunction&& other) noexcept : ops(other.ops) {
+            if (ops != nullptr) {
+                ops->move(other.storage, storage);
+                other.ops = nullptr;
+            }
+        }
+
+        InlineFunction& operator=(InlineFunction&& other) noexcept {
+            if (this != &other) {
+                reset();
+                if (other.ops != nullptr) {
+                    other.ops->move(other.storage, storage);
+                    ops       = other.ops;
+                    other.ops = nullptr;
+                }
+            }
+            return *this;
+        }
+
+        InlineFunction(const InlineFunction&) = delete;
+        InlineFunction& operator=(const InlineFunction&) = delete;
+
+        ~InlineFunction() {
+            reset();
+        }
+
+        /**
+         * @brief Destroys the stored callable leaving this function empty.
+         */
+        void reset() noexcept {
+            if (ops != nullptr) {
+                ops->destroy(storage);
+                ops = nullptr;
+            }
+        }
+
+        R operator()(Args... args) {
+            return ops->invoke(storage, std::forward<Args>(args)...);
+        }
+
+        explicit operator bool() const noexcept {
+            return ops != nullptr;
+        }
+
+    private:
+        /// @brief the operations for the callable we are holding, or nullptr if we are empty
+        const Operations* ops;
+        /// @brief the storage that holds our callable (or a pointer to it if it lives on the heap)
+        Storage storage;
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_INLINEFUNCTION_HPP
@@ -0,0 +1,171 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_OBJECTPOOL_HPP
+#define NUCLEAR_UTIL_OBJECTPOOL_HPP
+
+#include <algorithm>
+#include <memory>
+#include <mutex>
+#include <type_traits>
+#include <typeinfo>
+#include <vector>
+
+#include "nuclear_bits/PowerPlant.hpp"
+#include "nuclear_bits/dsl/trait/is_pooled.hpp"
+#include "nuclear_bits/message/PoolStatistics.hpp"
+#include "nuclear_bits/util/demangle.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief A pool of objects of a type that are reused rather than being destroyed.
+     *
+     * @details
+     *  Objects are taken from the pool with acquire and are given back by the deleter of the shared_ptr that is made
+     *  when they are emitted. An object that is given back is not destroyed, so any memory it owns is still there when
+     *  it is acquired again. Objects that were not acquired from the pool are adopted by it when they are released.
+     *
+     *  Each time the pool has to allocate a new object it emits a message::PoolStatistics.
+     *
+     * @tparam T the type of object the pool holds, which must have dsl::trait::is_pooled specialised to true
+     */
+    template <typename T>
+    class ObjectPool {
+    public:
+        /// @brief the most unused objects that will be kept in the pool, any more than this are deleted
+        static constexpr size_t capacity = 16;
+
+        /**
+         * @brief Take an object from the pool, or make a new one if the pool is empty.
+         *
+         * @details The object is in whatever state it was left in when it was released, so it should be reset before
+         *          it is used.
+         *
+         * @return an object that can be filled in and emitted
+         */
+        static std::unique_ptr<T> acquire() {
+
+            Pool& pool = get_pool();
+            std::unique_lock<std::mutex> lock(pool.mutex);
+
+            ++pool.in_use;
+            pool.high_water = std::max(pool.high_water, pool.in_use);
+
+            if (!pool.objects.empty()) {
+                std::unique_ptr<T> object = std::move(pool.objects.back());
+                pool.objects.pop_back();
+                ++pool.hits;
+                return object;
+            }
+
+            ++pool.misses;
+            auto stats = std::make_unique<message::PoolStatistics>(
+                demangle(typeid(T).name()), pool.hits, pool.misses, static_cast<uint64_t>(pool.high_water));
+            lock.unlock();
+
+            // Let anyone who is interested know the pool had to grow
+            if (PowerPlant::powerplant) {
+                PowerPlant::powerplant->emit(stats);
+            }
+
+            return std::make_unique<T>();
+        }
+
+        /**
+         * @brief Give an object back to the pool so it can be acquired again.
+         *
+         * @param object the object to give back
+         */
+        static void release(T* object) {
+
+            std::unique_ptr<T> owned(object);
+
+            Pool& pool = get_pool();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+
+            pool.in_use = std::max<int64_t>(0, pool.in_use - 1);
+            if (pool.objects.size() < capacity) {
+                pool.objects.push_back(std::move(owned));
+            }
+        }
+
+        /**
+         * @brief Share an object so that it is given back to the pool when the last reference to it is dropped.
+         *
+         * @param object the object to share
+         *
+         * @return a shared_ptr to the object that will release it to the pool
+         */
+        static std::shared_ptr<T> share(std::unique_ptr<T>&& object) {
+            return std::shared_ptr<T>(object.release(), &ObjectPool<T>::release);
+        }
+
+        /**
+         * @brief Get the current statistics for the pool.
+         */
+        static message::PoolStatistics statistics() {
+            Pool& pool = get_pool();
+            std::lock_guard<std::mutex> lock(pool.mutex);
+            return message::PoolStatistics(
+                demangle(typeid(T).name()), pool.hits, pool.misses, static_cast<uint64_t>(pool.high_water));
+        }
+
+    private:
+        struct Pool {
+            /// @brief the mutex that protects the pool
+            std::mutex mutex;
+            /// @brief the objects that are waiting to be reused
+            std::vector<std::unique_ptr<T>> objects;
+            /// @brief the number of objects that were reused
+            uint64_t hits = 0;
+            /// @brief the number of objects that had to be made
+            uint64_t misses = 0;
+            /// @brief the number of objects that are currently acquired
+            int64_t in_use = 0;
+            /// @brief the most objects that have been acquired at once
+            int64_t high_water = 0;
+        };
+
+        static Pool& get_pool() {
+            // This is never destroyed so messages that outlive static destruction can still be given back
+            static Pool* pool = new Pool();  // NOLINT
+            return *pool;
+        }
+    };
+
+    /**
+     * @brief Share emitted data, giving it back to its pool when it is finished with if its type is pooled.
+     */
+    template <typename T>
+    inline std::enable_if_t<!dsl::trait::is_pooled<T>::value, std::shared_ptr<T>> share_emitted(
+        std::unique_ptr<T>&& data) {
+        return std::shared_ptr<T>(std::move(data));
+    }
+
+    template <typename T>
+    inline std::enable_if_t<dsl::trait::is_pooled<T>::value, std::shared_ptr<T>> share_emitted(
+        std::unique_ptr<T>&& data) {
+        return ObjectPool<T>::share(std::move(data));
+    }
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_OBJECTPOOL_HPP
@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_RECYCLINGALLOCATOR_HPP
+#define NUCLEAR_UTIL_RECYCLINGALLOCATOR_HPP
+
+#include <cstddef>
+#include <mutex>
+#include <new>
+#include <vector>
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief An allocator that keeps the memory it has freed so it can be given out again without allocating.
+     *
+     * @details
+     *  Single objects that are deallocated are kept in a free list for their type (up to capacity of them) and are
+     *  handed back out by the next allocate. When used with std::allocate_shared the object and its control block are
+     *  allocated as one piece of memory, so both are recycled together.
+     *
+     *  All allocators for the same type share the same free list.
+     *
+     * @tparam T        the type of object being allocated
+     * @tparam capacity the maximum number of freed objects that will be kept for reuse
+     */
+    template <typename T, size_t capacity = 64>
+    class RecyclingAllocator {
+    public:
+        using value_type = T;
+
+        template <typename U>
+        struct rebind {
+            using other = RecyclingAllocator<U, capacity>;
+        };
+
+        RecyclingAllocator() = default;
+
+        template <typename U>
+        RecyclingAllocator(const RecyclingAllocator<U, capacity>&) {}
+
+        T* allocate(size_t n) {
+
+            // Reuse a freed object if we have one
+            if (n == 1) {
+                FreeList& list = free_list();
+                std::lock_guard<std::mutex> lock(list.mutex);
+                if (!list.blocks.empty()) {
+                    T* block = list.blocks.back();
+                    list.blocks.pop_back();
+                    return block;
+                }
+            }
+
+            return static_cast<T*>(::operator new(n * sizeof(T)));
+        }
+
+        void deallocate(T* block, size_t n) {
+
+            // Keep single objects for reuse if we have room
+            if (n == 1) {
+                FreeList& list = free_list();
+                std::lock_guard<std::mutex> lock(list.mutex);
+                if (list.blocks.size() < capacity) {
+                    list.blocks.push_back(block);
+                    return;
+                }
+            }
+
+            ::operator delete(block);
+        }
+
+        template <typename U>
+        bool operator==(const RecyclingAllocator<U, capacity>&) const {
+            return true;
+        }
+
+        template <typename U>
+        bool operator!=(const RecyclingAllocator<U, capacity>&) const {
+            return false;
+        }
+
+    private:
+        struct FreeList {
+            /// @brief the mutex that protects the blocks
+            std::mutex mutex;
+            /// @brief the freed memory that is waiting to be reused
+            std::vector<T*> blocks;
+        };
+
+        static FreeList& free_list() {
+            // This is never destroyed so messages that outlive static destruction can still be given back
+            static FreeList* list = new FreeList();  // NOLINT
+            return *list;
+        }
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_RECYCLINGALLOCATOR_HPP
@@ -19,13 +19,30 @@
 #ifndef NUCLEAR_UTIL_TYPELIST_HPP
 #define NUCLEAR_UTIL_TYPELIST_HPP
 
+#include <functional>
 #include <memory>
 #include <mutex>
 #include <vector>
 
+#include "nuclear_bits/util/TypeListBatch.hpp"
+#include "nuclear_bits/util/TypeMap.hpp"
+
 namespace NUClear {
 namespace util {
 
+    /**
+     * @brief A list of values stored by type that can be read from many threads while it is being changed.
+     *
+     * @details
+     *  The list is copy on write. Readers get an immutable snapshot of the list that they can iterate without any
+     *  locking, and that stays valid even if the list is changed while they are using it. Changes copy the current
+     *  list, modify the copy and then publish it atomically. If a TypeListBatch is active on the changing thread the
+     *  change is held back until the batch finishes, so many changes only publish one new snapshot.
+     *
+     * @attention
+     *  Note that because this is an entirely static class, if two lists with the same MapID are used, they access the
+     *  same list
+     */
     template <typename MapID, typename Key, typename Value>
     class TypeList {
     private:
@@ -33,23 +50,71 @@ namespace util {
         TypeList() = delete;
         /// @brief Deleted destructor as this class is a static class.
         ~TypeList() = delete;
-        /// @brief the data variable where the data is stored for this map key.
-        static std::vector<Value> data;
+
+        /// @brief the snapshots of our list are published through a TypeMap so reading them never locks
+        using Snapshot = TypeMap<TypeList<MapID, Key, Value>, Key, const std::vector<Value>>;
+
+        /// @brief a change to be made to the list
+        using Change = std::function<void(std::vector<Value>&)>;
+
+        /// @brief the changes to this list that are waiting for a TypeListBatch to finish
+        struct BatchChanges : public TypeListBatch::Changes {
+            std::vector<Change> changes;
+
+            void apply() override {
+                TypeList::apply(changes);
+            }
+        };
+
+        /// @brief stops two threads copying the list at the same time and losing one of their changes
+        static std::mutex mutex;
+
+        /// @brief copies the list, makes all of the changes to the copy and then publishes it
+        static void apply(const std::vector<Change>& changes) {
+            std::lock_guard<std::mutex> lock(mutex);
+
+            auto list = std::make_shared<std::vector<Value>>(*get());
+            for (const auto& change : changes) {
+                change(*list);
+            }
+            Snapshot::set(std::move(list));
+        }
 
     public:
         /**
-         * @brief Gets the list that is stored in this type location
+         * @brief Gets a snapshot of the list that is stored in this type location
+         *
+         * @return A pointer to the vector stored in this location, this will not change even if the list is modified
+         */
+        static std::shared_ptr<const std::vector<Value>> get() {
+            static const std::shared_ptr<const std::vector<Value>> empty = std::make_shared<std::vector<Value>>();
+
+            auto list = Snapshot::get();
+            return list ? list : empty;
+        }
+
+        /**
+         * @brief Changes the list stored in this type location.
+         *
+         * @details The change is made to a copy of the list which then replaces it, if a TypeListBatch is active on
+         *          this thread the change is made when the batch finishes.
          *
-         * @return A reference to the vector stored in this location
+         * @param change a function that modifies the list it is given
          */
-        static std::vector<Value>& get() {
-            return data;
+        static void modify(Change change) {
+            TypeListBatch* batch = TypeListBatch::current();
+            if (batch != nullptr) {
+                batch->get<BatchChanges>().changes.push_back(std::move(change));
+            }
+            else {
+                apply({std::move(change)});
+            }
         }
     };
 
-    /// Initialize our type list data
+    /// Initialize our writer mutex
     template <typename MapID, typename Key, typename Value>
-    std::vector<Value> TypeList<MapID, Key, Value>::data;
+    std::mutex TypeList<MapID, Key, Value>::mutex;
 
 }  // namespace util
 }  // namespace NUClear
@@ -0,0 +1,107 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_TYPELISTBATCH_HPP
+#define NUCLEAR_UTIL_TYPELISTBATCH_HPP
+
+#include <memory>
+#include <typeindex>
+#include <utility>
+#include <vector>
+
+#include "nuclear_bits/util/platform.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /**
+     * @brief Collects changes to TypeLists so that each list is only republished once.
+     *
+     * @details
+     *  While one of these exists, every change this thread makes to a TypeList is held back. When the outermost batch
+     *  is destroyed the changes to each list are applied together and published as a single new snapshot. This makes
+     *  binding or unbinding many reactions at once (for example when switching modes) much cheaper, and means emitters
+     *  never see a half finished set of reactions for a type.
+     *  @code
+     *  {
+     *      NUClear::util::TypeListBatch batch;
+     *      for (auto& h : old_mode) { h.unbind(); }
+     *      new_mode.push_back(on<Trigger<T>>().then(...));
+     *  }
+     *  @endcode
+     *  Batches can be nested, only the outermost batch publishes.
+     */
+    class TypeListBatch {
+    public:
+        /// @brief the changes that have been made to one TypeList in this batch
+        struct Changes {
+            virtual ~Changes() = default;
+            /// @brief applies the changes to the list and publishes them
+            virtual void apply() = 0;
+        };
+
+        TypeListBatch() : outer(active == nullptr) {
+            if (outer) {
+                active = this;
+            }
+        }
+
+        ~TypeListBatch() {
+            if (outer) {
+                // Stop batching first so anything that happens while we publish is applied straight away
+                active = nullptr;
+                for (auto& c : changes) {
+                    c.second->apply();
+                }
+            }
+        }
+
+        TypeListBatch(const TypeListBatch&) = delete;
+        TypeListBatch& operator=(const TypeListBatch&) = delete;
+
+        /// @brief the batch that is collecting changes on this thread, or nullptr if changes are applied immediately
+        static TypeListBatch* current() {
+            return active;
+        }
+
+        /// @brief gets the changes that have been collected for a list, creating them if this is the first
+        template <typename ListChanges>
+        ListChanges& get() {
+            for (auto& c : changes) {
+                if (c.first == typeid(ListChanges)) {
+                    return static_cast<ListChanges&>(*c.second);
+                }
+            }
+            changes.emplace_back(typeid(ListChanges), std::make_unique<ListChanges>());
+            return static_cast<ListChanges&>(*changes.back().second);
+        }
+
+    private:
+        /// @brief if this is the batch that will publish the changes
+        bool outer;
+        /// @brief the changes for each list, in the order the lists were first changed
+        std::vector<std::pair<std::type_index, std::unique_ptr<Changes>>> changes;
+
+        /// @brief the batch that is active on this thread
+        static ATTRIBUTE_TLS TypeListBatch* active;  // NOLINT
+    };
+
+}  // namespace util
+}  // namespace NUClear
+
+#endif  // NUCLEAR_UTIL_TYPELISTBATCH_HPP
@@ -19,8 +19,11 @@
 #ifndef NUCLEAR_UTIL_TYPEMAP_HPP
 #define NUCLEAR_UTIL_TYPEMAP_HPP
 
+#include <atomic>
+#include <chrono>
 #include <memory>
 #include <mutex>
+#include <thread>
 #include <vector>
 
 namespace NUClear {
@@ -37,6 +40,10 @@ namespace util {
      *  provided through the MapType parameter the operation of each of these is described in their individual
      *  documentation.
      *
+     *  Reading from the map never takes a lock. The value is held in one of a small number of slots and readers
+     *  announce which slot they are copying from. A writer fills a slot that nobody is reading and then publishes it
+     *  with a single atomic store, so readers only ever retry if a new value was published while they were reading.
+     *
      * @attention
      *  Note that because this is an entirely static class, if two maps with the same MapID are used, they access the
      *  same map
@@ -48,9 +55,23 @@ namespace util {
         TypeMap() = delete;
         /// @brief Deleted destructor as this class is a static class.
         ~TypeMap() = delete;
-        /// @brief the data variable where the data is stored for this map key.
 
-        static std::shared_ptr<Value> data;
+        /// @brief a place that a value can be published from
+        struct Slot {
+            /// @brief the data stored in this slot
+            std::shared_ptr<Value> data;
+            /// @brief how many threads are copying data out of this slot right now
+            std::atomic<int> readers{0};
+        };
+
+        /// @brief how many slots there are, more slots means a writer is less likely to wait for a slow reader
+        static constexpr int SLOTS = 4;
+
+        /// @brief the slots the data is stored in
+        static Slot slots[SLOTS];
+        /// @brief the slot that holds the current value
+        static std::atomic<int> current;
+        /// @brief the mutex that stops two writers filling the same slot (readers never use it)
         static std::mutex mutex;
 
     public:
@@ -61,12 +82,43 @@ namespace util {
          */
         static void set(std::shared_ptr<Value> d) {
 
-            // Do this once G++ supports it
-            // std::atomic_store_explicit(&data, d, std::memory_order_relaxed);
+            // The values we replace are released after we unlock in case their destructors take a while
+            std::shared_ptr<Value> previous;
+
+            /* Mutex Scope */ {
+                std::lock_guard<std::mutex> lock(mutex);
+                int old = current.load();
+
+                // Find a slot nobody is reading from, readers only hold a slot while they copy a shared_ptr
+                for (int attempt = 0;; ++attempt) {
+                    int next = -1;
+                    for (int i = 0; i < SLOTS && next < 0; ++i) {
+                        if (i != old && slots[i].readers.load() == 0) {
+                            next = i;
+                        }
+                    }
+
+                    if (next >= 0) {
+                        std::swap(slots[next].data, d);
+                        current.store(next);
+                        break;
+                    }
 
-            // Lock a mutex and set our data
-            std::lock_guard<std::mutex> lock(mutex);
-            data = std::move(d);
+                    // Yielding never lets a thread with a lower OS priority run so if it's taking a while, sleep
+                    if (attempt < 16) {
+                        std::this_thread::yield();
+                    }
+                    else {
+                        std::this_thread::sleep_for(std::chrono::microseconds(50));
+                    }
+                }
+
+                // Let go of the previous value now if we can so it doesn't live any longer than it used to. Anyone who
+                // starts reading the old slot after this check will see it isn't current anymore and leave it alone.
+                if (slots[old].readers.load() == 0) {
+                    previous = std::move(slots[old].data);
+                }
+            }
         }
 
         /**
@@ -76,22 +128,30 @@ namespace util {
          */
         static std::shared_ptr<Value> get() {
 
-            // TODO do this when gcc supports it
-            // std::atomic_load_explicit(&data, std::memory_order_relaxed);
+            while (true) {
+                int i = current.load();
 
-            std::shared_ptr<Value> d;
-            {
-                std::lock_guard<std::mutex> lock(mutex);
-                d = data;
-            }
+                // Tell writers we are reading from this slot, then make sure it is still the current one
+                slots[i].readers.fetch_add(1);
+                if (current.load() == i) {
+                    std::shared_ptr<Value> d = slots[i].data;
+                    slots[i].readers.fetch_sub(1);
+                    return d;
+                }
 
-            return d;
+                // A new value was published while we were getting ready, go and read that one instead
+                slots[i].readers.fetch_sub(1);
+            }
         }
     };
 
-    /// Initialize our shared_ptr data
+    /// Initialize our data slots
+    template <typename MapID, typename Key, typename Value>
+    constexpr int TypeMap<MapID, Key, Value>::SLOTS;
+    template <typename MapID, typename Key, typename Value>
+    typename TypeMap<MapID, Key, Value>::Slot TypeMap<MapID, Key, Value>::slots[TypeMap<MapID, Key, Value>::SLOTS];
     template <typename MapID, typename Key, typename Value>
-    std::shared_ptr<Value> TypeMap<MapID, Key, Value>::data;
+    std::atomic<int> TypeMap<MapID, Key, Value>::current(0);
     template <typename MapID, typename Key, typename Value>
     std::mutex TypeMap<MapID, Key, Value>::mutex;
 
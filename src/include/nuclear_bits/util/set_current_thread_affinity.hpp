@@ -0,0 +1,95 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#ifndef NUCLEAR_UTIL_SET_CURRENT_THREAD_AFFINITY_HPP
+#define NUCLEAR_UTIL_SET_CURRENT_THREAD_AFFINITY_HPP
+
+#include <vector>
+
+#if defined(__linux__)
+
+#include <pthread.h>
+#include <sched.h>
+
+/**
+ * @brief Restricts the current thread so it only runs on the given CPUs.
+ *
+ * @param cpus the CPUs the thread may run on, if this is empty the thread is left alone
+ *
+ * @return true if the affinity of the thread was changed
+ */
+inline bool set_current_thread_affinity(const std::vector<int>& cpus) {
+
+    if (cpus.empty()) {
+        return false;
+    }
+
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (const auto& cpu : cpus) {
+        if (cpu >= 0 && cpu < CPU_SETSIZE) {
+            CPU_SET(cpu, &set);
+        }
+    }
+
+    return pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+}
+
+/**
+ * @brief Gets the CPU that the current thread is running on.
+ *
+ * @return the CPU the current thread is running on, or -1 if it is not known
+ */
+inline int get_current_cpu() {
+    return sched_getcpu();
+}
+
+#elif defined(_WIN32)
+
+#include "nuclear_bits/util/windows_includes.hpp"
+
+inline bool set_current_thread_affinity(const std::vector<int>& cpus) {
+
+    DWORD_PTR mask = 0;
+    for (const auto& cpu : cpus) {
+        if (cpu >= 0 && cpu < static_cast<int>(sizeof(DWORD_PTR) * 8)) {
+            mask |= DWORD_PTR(1) << cpu;
+        }
+    }
+
+    return mask != 0 && SetThreadAffinityMask(GetCurrentThread(), mask) != 0;
+}
+
+inline int get_current_cpu() {
+    return static_cast<int>(GetCurrentProcessorNumber());
+}
+
+#else
+
+// Other platforms (such as OSX) do not let us pin threads to CPUs
+inline bool set_current_thread_affinity(const std::vector<int>&) {
+    return false;
+}
+
+inline int get_current_cpu() {
+    return -1;
+}
+
+#endif
+
+#endif  // NUCLEAR_UTIL_SET_CURRENT_THREAD_AFFINITY_HPP
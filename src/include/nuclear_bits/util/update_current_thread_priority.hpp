@@ -19,19 +19,46 @@
 #ifndef NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_PRIORITY_HPP
 #define NUCLEAR_UTIL_UPDATE_CURRENT_THREAD_PRIORITY_HPP
 
+#include "nuclear_bits/util/platform.hpp"
+
+namespace NUClear {
+namespace util {
+
+    /// @brief if NUClear is allowed to change the OS scheduling priority of its threads
+    extern bool thread_priority_enabled;
+
+    /// @brief the OS priority that we last set for the current thread (so we can skip setting it again)
+    extern ATTRIBUTE_TLS int current_thread_os_priority;
+
+}  // namespace util
+}  // namespace NUClear
+
 #ifndef _WIN32
 
 #include <pthread.h>
 
 inline void update_current_thread_priority(int priority) {
 
+    // We have been told to leave the OS scheduling alone
+    if (!NUClear::util::thread_priority_enabled) {
+        return;
+    }
 
     // TODO SCHED_NORMAL for normal threads
     // TODO SCHED_FIFO for realtime threads
     // TODO SCHED_RR for high priority threads
 
-    auto sched_priority = sched_get_priority_min(SCHED_RR)
-                          + (priority / (sched_get_priority_max(SCHED_RR) - sched_get_priority_min(SCHED_RR)));
+    // These never change so we only ask the OS once
+    static const int min_priority = sched_get_priority_min(SCHED_RR);
+    static const int max_priority = sched_get_priority_max(SCHED_RR);
+
+    auto sched_priority = min_priority + (priority / (max_priority - min_priority));
+
+    // If we are already at this priority (or failed to set it last time) there is nothing to do
+    if (NUClear::util::current_thread_os_priority == sched_priority) {
+        return;
+    }
+    NUClear::util::current_thread_os_priority = sched_priority;
 
     sched_param p;
     p.sched_priority = sched_priority;
@@ -45,7 +72,19 @@ inline void update_current_thread_priority(int priority) {
 
 inline void update_current_thread_priority(int priority) {
 
-    switch ((priority * 7) / 1000) {
+    // We have been told to leave the OS scheduling alone
+    if (!NUClear::util::thread_priority_enabled) {
+        return;
+    }
+
+    // If we are already at this priority level there is nothing to do
+    int level = (priority * 7) / 1000;
+    if (NUClear::util::current_thread_os_priority == level) {
+        return;
+    }
+    NUClear::util::current_thread_os_priority = level;
+
+    switch (level) {
         case 0: {
             SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_IDLE);
         } break;
@@ -17,6 +17,7 @@
  */
 #include "nuclear_bits/threading/Reaction.hpp"
 
+#include <limits>
 #include <utility>
 
 namespace NUClear {
@@ -32,7 +33,9 @@ namespace threading {
         , emit_stats(true)
         , active_tasks(0)
         , enabled(true)
-        , generator(generator) {}
+        , max_active_tasks(std::numeric_limits<int>::max())
+        , run_inline(false)
+        , generator(std::move(generator)) {}
 
     void Reaction::unbind() {
         // Unbind
@@ -43,14 +46,14 @@ namespace threading {
 
     std::unique_ptr<ReactionTask> Reaction::get_task() {
 
-        // If we are not enabled, don't run
-        if (!enabled) {
+        // If we are not enabled or already have as many tasks as we can (e.g. a full Buffer) don't run our generator
+        if (!enabled || active_tasks >= max_active_tasks) {
             return std::unique_ptr<ReactionTask>(nullptr);
         }
 
         // Run our generator to get a functor we can run
         int priority;
-        std::function<std::unique_ptr<ReactionTask>(std::unique_ptr<ReactionTask> &&)> func;
+        ReactionTask::TaskFunction func;
         std::tie(priority, func) = generator(*this);
 
         // If our generator returns a valid function
@@ -17,6 +17,7 @@
  */
 #include "nuclear_bits/threading/ReactionTask.hpp"
 
+#include <new>
 #include <utility>
 #include "nuclear_bits/threading/Reaction.hpp"
 
@@ -26,24 +27,100 @@ namespace threading {
     // Initialize our id source
     std::atomic<uint64_t> ReactionTask::task_id_source(0);  // NOLINT
 
+    // Initialize our statistics listener count
+    std::atomic<unsigned int> ReactionTask::statistics_listeners(0);  // NOLINT
+
     // Initialize our current task
     ATTRIBUTE_TLS ReactionTask* ReactionTask::current_task = nullptr;  // NOLINT
 
+    // Initialize our next task
+    ATTRIBUTE_TLS ReactionTask* ReactionTask::next_task = nullptr;  // NOLINT
+
+    namespace {
+        /// @brief the memory of a freed ReactionTask that is waiting to be reused
+        struct FreeTask {
+            FreeTask* next;
+        };
+
+        /// @brief the maximum number of freed ReactionTasks that a single thread will keep for reuse
+        constexpr size_t max_free_tasks = 1024;
+
+        /// @brief the freed ReactionTasks that this thread is keeping for reuse
+        ATTRIBUTE_TLS FreeTask* free_tasks = nullptr;  // NOLINT
+        /// @brief the number of ReactionTasks in the free list
+        ATTRIBUTE_TLS size_t free_task_count = 0;  // NOLINT
+        /// @brief if this thread keeps freed ReactionTasks, only threads that will release them before exiting do
+        ATTRIBUTE_TLS bool keep_free_tasks = false;  // NOLINT
+    }  // namespace
+
     ReactionTask::ReactionTask(Reaction& parent, int priority, TaskFunction&& callback)
         : parent(parent)
         , id(++task_id_source)
+        , cause_reaction_id(current_task != nullptr ? current_task->parent.id : 0)
+        , cause_task_id(current_task != nullptr ? current_task->id : 0)
         , priority(priority)
-        , stats(new message::ReactionStatistics{parent.identifier,
-                                                parent.id,
-                                                id,
-                                                current_task != nullptr ? current_task->parent.id : 0,
-                                                current_task != nullptr ? current_task->id : 0,
-                                                clock::now(),
-                                                clock::time_point(std::chrono::seconds(0)),
-                                                clock::time_point(std::chrono::seconds(0)),
-                                                nullptr})
+        , timing{clock::now(), clock::time_point(), clock::time_point()}
+        , exception(nullptr)
+        , stats(nullptr)
         , emit_stats(parent.emit_stats && (current_task != nullptr ? current_task->emit_stats : true))
-        , callback(callback) {
+        , callback(std::move(callback)) {}
+
+    std::unique_ptr<message::ReactionStatistics> ReactionTask::make_stats() const {
+        return std::make_unique<message::ReactionStatistics>(parent.identifier,
+                                                             parent.id,
+                                                             id,
+                                                             cause_reaction_id,
+                                                             cause_task_id,
+                                                             timing.emitted,
+                                                             timing.started,
+                                                             timing.finished,
+                                                             exception);
+    }
+
+    std::shared_ptr<const message::ReactionStatistics> ReactionTask::get_stats() const {
+        if (!stats) {
+            stats = make_stats();
+        }
+        return stats;
+    }
+
+    void* ReactionTask::operator new(std::size_t size) {
+
+        // Reuse a task that this thread freed earlier if we can
+        if (size == sizeof(ReactionTask) && free_tasks != nullptr) {
+            FreeTask* task = free_tasks;
+            free_tasks     = task->next;
+            --free_task_count;
+            return task;
+        }
+
+        return ::operator new(size);
+    }
+
+    void ReactionTask::operator delete(void* ptr, std::size_t size) {
+
+        // Keep the memory for the next task unless we already have plenty
+        if (ptr != nullptr && keep_free_tasks && size == sizeof(ReactionTask) && free_task_count < max_free_tasks) {
+            free_tasks = new (ptr) FreeTask{free_tasks};
+            ++free_task_count;
+        }
+        else {
+            ::operator delete(ptr);
+        }
+    }
+
+    void ReactionTask::use_free_list() {
+        keep_free_tasks = true;
+    }
+
+    void ReactionTask::release_free_list() {
+        keep_free_tasks = false;
+        while (free_tasks != nullptr) {
+            FreeTask* task = free_tasks;
+            free_tasks     = task->next;
+            ::operator delete(task);
+        }
+        free_task_count = 0;
     }
 
     const ReactionTask* ReactionTask::get_current_task() {
@@ -59,11 +136,27 @@ namespace threading {
         // Run our callback at catch the returned task (to see if it rescheduled itself)
         us = callback(std::move(us));
 
+        // Run any tasks that were given to us to run after this one
+        while (next_task != nullptr) {
+            std::unique_ptr<ReactionTask> task(next_task);
+            next_task    = nullptr;
+            current_task = task.get();
+            task         = task->callback(std::move(task));
+        }
+
         // Reset our task back
         current_task = old_task;
 
         // Return our original task
         return std::move(us);
     }
+
+    bool ReactionTask::run_next(std::unique_ptr<ReactionTask>&& task) {
+        if (next_task != nullptr) {
+            return false;
+        }
+        next_task = task.release();
+        return true;
+    }
 }  // namespace threading
 }  // namespace NUClear
@@ -0,0 +1,211 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+#include "nuclear_bits/threading/TaskQueue.hpp"
+
+#include "nuclear_bits/dsl/word/Priority.hpp"
+
+namespace NUClear {
+namespace threading {
+
+    constexpr int TaskQueue::EMPTY;
+
+    const int TaskQueue::priorities[] = {dsl::word::Priority::REALTIME::value,
+                                         dsl::word::Priority::HIGH::value,
+                                         dsl::word::Priority::NORMAL::value,
+                                         dsl::word::Priority::LOW::value,
+                                         dsl::word::Priority::IDLE::value};
+
+    TaskQueue::Ring::Ring(size_t capacity) : mask(capacity - 1), cells(new Cell[capacity]), tail(0), head(0) {
+
+        // Each cell starts out ready to be written for its own position
+        for (size_t i = 0; i < capacity; ++i) {
+            cells[i].sequence.store(i, std::memory_order_relaxed);
+            cells[i].task = nullptr;
+        }
+    }
+
+    bool TaskQueue::Ring::push(ReactionTask* task) {
+
+        size_t pos = tail.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos);
+
+            // This cell is free, try to claim it
+            if (diff == 0) {
+                if (tail.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    cell.task = task;
+                    cell.sequence.store(pos + 1, std::memory_order_release);
+                    return true;
+                }
+            }
+            // This cell still holds a task from the last time around, we are full
+            else if (diff < 0) {
+                return false;
+            }
+            // Someone else claimed this position before us
+            else {
+                pos = tail.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    ReactionTask* TaskQueue::Ring::pop() {
+
+        size_t pos = head.load(std::memory_order_relaxed);
+        while (true) {
+            Cell& cell = cells[pos & mask];
+            size_t seq = cell.sequence.load(std::memory_order_acquire);
+            auto diff  = static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1);
+
+            // This cell has a task in it, try to claim it
+            if (diff == 0) {
+                if (head.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                    ReactionTask* task = cell.task;
+                    cell.sequence.store(pos + mask + 1, std::memory_order_release);
+                    return task;
+                }
+            }
+            // Nothing has been written to this cell yet, we are empty
+            else if (diff < 0) {
+                return nullptr;
+            }
+            // Someone else took this position before us
+            else {
+                pos = head.load(std::memory_order_relaxed);
+            }
+        }
+    }
+
+    bool TaskQueue::Ring::empty() const {
+        size_t pos = head.load(std::memory_order_acquire);
+        size_t seq = cells[pos & mask].sequence.load(std::memory_order_acquire);
+        return static_cast<intptr_t>(seq) - static_cast<intptr_t>(pos + 1) < 0;
+    }
+
+    TaskQueue::TaskQueue(size_t capacity)
+        : overflow_priority(EMPTY), overflowed(new std::atomic<size_t>[sizeof(priorities) / sizeof(priorities[0])]) {
+        for (size_t i = 0; i < sizeof(priorities) / sizeof(priorities[0]); ++i) {
+            rings.push_back(std::make_unique<Ring>(capacity));
+            overflowed[i] = 0;
+        }
+    }
+
+    TaskQueue::~TaskQueue() {
+        // Delete any tasks that are still in our rings (the overflow queue cleans itself up)
+        for (auto& ring : rings) {
+            for (ReactionTask* task = ring->pop(); task != nullptr; task = ring->pop()) {
+                delete task;  // NOLINT
+            }
+        }
+    }
+
+    int TaskQueue::bucket(int priority) {
+        for (size_t i = 0; i < sizeof(priorities) / sizeof(priorities[0]); ++i) {
+            if (priorities[i] == priority) {
+                return static_cast<int>(i);
+            }
+        }
+        return -1;
+    }
+
+    void TaskQueue::push(std::unique_ptr<ReactionTask>&& task) {
+
+        // Standard priorities go into their ring if there is space and none of them are waiting in the overflow queue
+        int b = bucket(task->priority);
+        if (b >= 0 && overflowed[b] == 0 && rings[b]->push(task.get())) {
+            task.release();
+            return;
+        }
+
+        // Everything else goes into the overflow queue
+        std::lock_guard<std::mutex> lock(overflow_mutex);
+        if (b >= 0) {
+            ++overflowed[b];
+        }
+        overflow.push(std::move(task));
+        overflow_priority = overflow.top()->priority;
+    }
+
+    std::unique_ptr<ReactionTask> TaskQueue::pop_overflow() {
+
+        // priority queue's top is const so we must cast to move the unique pointer out
+        std::unique_ptr<ReactionTask> task(
+            std::move(const_cast<std::unique_ptr<ReactionTask>&>(overflow.top())));  // NOLINT
+        overflow.pop();
+        overflow_priority = overflow.empty() ? EMPTY : overflow.top()->priority;
+
+        // Once a priority has no more overflowed tasks it can use its ring again
+        int b = bucket(task->priority);
+        if (b >= 0) {
+            --overflowed[b];
+        }
+        return task;
+    }
+
+    std::unique_ptr<ReactionTask> TaskQueue::pop() {
+
+        for (size_t i = 0; i < rings.size(); ++i) {
+
+            // If the overflow queue has something more important than this ring, it goes first
+            if (overflow_priority > priorities[i]) {
+                std::lock_guard<std::mutex> lock(overflow_mutex);
+
+                if (!overflow.empty() && overflow.top()->priority > priorities[i]) {
+                    return pop_overflow();
+                }
+            }
+
+            ReactionTask* task = rings[i]->pop();
+            if (task != nullptr) {
+                return std::unique_ptr<ReactionTask>(task);
+            }
+        }
+
+        // The only thing left is things in the overflow queue that are below every ring
+        if (overflow_priority != EMPTY) {
+            std::lock_guard<std::mutex> lock(overflow_mutex);
+
+            if (!overflow.empty()) {
+                return pop_overflow();
+            }
+        }
+
+        return nullptr;
+    }
+
+    int TaskQueue::priority() const {
+
+        int o = overflow_priority;
+
+        // The first ring that is not empty holds the most important task from the rings
+        for (size_t i = 0; i < rings.size(); ++i) {
+            if (o >= priorities[i]) {
+                return o;
+            }
+            if (!rings[i]->empty()) {
+                return priorities[i];
+            }
+        }
+
+        return o;
+    }
+
+}  // namespace threading
+}  // namespace NUClear
@@ -18,10 +18,39 @@
 
 #include "nuclear_bits/threading/TaskScheduler.hpp"
 
+#include "nuclear_bits/util/set_current_thread_affinity.hpp"
+#include "nuclear_bits/util/update_current_thread_priority.hpp"
+
 namespace NUClear {
 namespace threading {
 
-    TaskScheduler::TaskScheduler() : running(true) {}
+    // Initialize our thread local queue information
+    ATTRIBUTE_TLS TaskScheduler* TaskScheduler::current_scheduler = nullptr;  // NOLINT
+    ATTRIBUTE_TLS TaskQueue* TaskScheduler::current_queue = nullptr;          // NOLINT
+    ATTRIBUTE_TLS int TaskScheduler::current_node = 0;                         // NOLINT
+
+    TaskScheduler::TaskScheduler(size_t thread_count,
+                                 bool work_stealing,
+                                 size_t spin_count,
+                                 size_t yield_count,
+                                 const std::vector<std::vector<int>>& numa_nodes)
+        : running(true)
+        , local_queue_nodes(new std::atomic<int>[work_stealing ? thread_count : 0])
+        , next_local_queue(0)
+        , numa_nodes(numa_nodes)
+        // With only one CPU nothing can submit a task while we spin so it just keeps the submitter waiting longer
+        , spin_count(std::thread::hardware_concurrency() > 1 ? spin_count : 0)
+        , yield_count(yield_count)
+        , sleeping(0) {
+
+        // Build a local queue for each of the threads that will steal work
+        if (work_stealing) {
+            for (size_t i = 0; i < thread_count; ++i) {
+                local_queues.push_back(std::make_unique<TaskQueue>());
+                local_queue_nodes[i] = 0;
+            }
+        }
+    }
 
     void TaskScheduler::shutdown() {
         {
@@ -31,51 +60,177 @@ namespace threading {
         condition.notify_all();
     }
 
+    TaskQueue* TaskScheduler::local_queue() {
+
+        // We already have a queue from this scheduler
+        if (current_scheduler == this) {
+            return current_queue;
+        }
+
+        // Claim the next free local queue if there is one (threads that don't take tasks from us never get here)
+        size_t index = next_local_queue++;
+        current_scheduler = this;
+        current_queue     = index < local_queues.size() ? local_queues[index].get() : nullptr;
+
+        // Work out which NUMA node we are on from the CPU we are running on
+        current_node = 0;
+        int cpu      = get_current_cpu();
+        for (size_t node = 0; node < numa_nodes.size(); ++node) {
+            if (std::find(numa_nodes[node].begin(), numa_nodes[node].end(), cpu) != numa_nodes[node].end()) {
+                current_node = static_cast<int>(node);
+            }
+        }
+        if (current_queue != nullptr) {
+            local_queue_nodes[index] = current_node;
+        }
+
+        return current_queue;
+    }
+
+    bool TaskScheduler::is_current_thread() const {
+        return current_scheduler == this;
+    }
+
+    TaskQueue* TaskScheduler::best_queue(TaskQueue* local) {
+
+        // Start with our own queue, and only move to another if it is advertising a strictly higher priority
+        TaskQueue* best = local != nullptr ? local : &queue;
+        int priority    = best->priority();
+
+        if (queue.priority() > priority) {
+            best     = &queue;
+            priority = queue.priority();
+        }
+
+        // Look through the other threads queues on our node to see if there is anything more important to steal
+        for (size_t i = 0; i < local_queues.size(); ++i) {
+            if (local_queue_nodes[i] == current_node && local_queues[i]->priority() > priority) {
+                best     = local_queues[i].get();
+                priority = best->priority();
+            }
+        }
+
+        // Then look at the other nodes, these are only used if they have something more important
+        for (size_t i = 0; i < local_queues.size(); ++i) {
+            if (local_queue_nodes[i] != current_node && local_queues[i]->priority() > priority) {
+                best     = local_queues[i].get();
+                priority = best->priority();
+            }
+        }
+
+        return priority == TaskQueue::EMPTY ? nullptr : best;
+    }
+
     void TaskScheduler::submit(std::unique_ptr<ReactionTask>&& task) {
 
         // We do not accept new tasks once we are shutdown
         if (running) {
 
+            // If we are one of our own threads put the task on our local queue, otherwise on the shared queue
+            TaskQueue* q = current_scheduler == this && current_queue != nullptr ? current_queue : &queue;
+            q->push(std::forward<std::unique_ptr<ReactionTask>>(task));
+        }
+
+        // Make sure our task is visible before we look for sleeping threads (pairs with the fence in get_task)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+
+        // Only wake a thread if one is asleep, threads that are spinning will find the task on their own
+        if (sleeping > 0) {
+            // We must hold the mutex so a thread can't miss the task while it is deciding to go to sleep
             /* Mutex Scope */ {
                 std::lock_guard<std::mutex> lock(mutex);
-                queue.push(std::forward<std::unique_ptr<ReactionTask>>(task));
             }
+            condition.notify_one();
         }
-
-        // Notify a thread that it can proceed
-        condition.notify_one();
     }
 
-    std::unique_ptr<ReactionTask> TaskScheduler::get_task() {
+    void TaskScheduler::submit(std::vector<std::unique_ptr<ReactionTask>>&& tasks) {
 
-        // Obtain the lock
-        std::unique_lock<std::mutex> lock(mutex);
+        // We do not accept new tasks once we are shutdown
+        if (running) {
 
-        // While our queue is empty
-        while (queue.empty()) {
+            // All of the tasks go onto the same queue in the order they were given to us
+            TaskQueue* q = current_scheduler == this && current_queue != nullptr ? current_queue : &queue;
+            for (auto& task : tasks) {
+                q->push(std::move(task));
+            }
+        }
 
-            // If the queue is empty we either wait or shutdown
-            if (!running) {
+        // Make sure our tasks are visible before we look for sleeping threads (pairs with the fence in get_task)
+        std::atomic_thread_fence(std::memory_order_seq_cst);
 
-                // Notify any other threads that might be waiting on this condition
+        // Only wake threads if some are asleep, and wake them all at once if there is enough work for them
+        if (sleeping > 0) {
+            /* Mutex Scope */ {
+                std::lock_guard<std::mutex> lock(mutex);
+            }
+            if (tasks.size() > 1) {
                 condition.notify_all();
+            }
+            else {
+                condition.notify_one();
+            }
+        }
+    }
+
+    std::unique_ptr<ReactionTask> TaskScheduler::get_task() {
 
-                // Return a nullptr to signify there is nothing on the queue
-                return nullptr;
+        TaskQueue* local = local_queue();
+
+        size_t idle = 0;
+        while (true) {
+
+            // Take the most important task we can find
+            for (TaskQueue* q = best_queue(local); q != nullptr; q = best_queue(local)) {
+                std::unique_ptr<ReactionTask> task = q->pop();
+                if (task) {
+                    return task;
+                }
             }
 
-            // Wait for something to happen!
-            condition.wait(lock);
-        }
+            // Spin and then yield for a while before going to sleep in case another task turns up soon
+            if (running && idle < spin_count) {
+                ++idle;
+                continue;
+            }
+            if (running && idle < spin_count + yield_count) {
+                ++idle;
+                std::this_thread::yield();
+                continue;
+            }
+
+            // Sleep at a high (but not realtime) priority so we pick up the next task quickly, whatever we last ran
+            update_current_thread_priority(1000);
+
+            // Obtain the lock
+            std::unique_lock<std::mutex> lock(mutex);
 
-        // Return the type
-        // If you're wondering why all the ridiculousness, it's because priority queue is not as feature complete as it
-        // should be its 'top' method returns a const reference (which we can't use to move a unique pointer)
-        std::unique_ptr<ReactionTask> task(
-            std::move(const_cast<std::unique_ptr<ReactionTask>&>(queue.top())));  // NOLINT
-        queue.pop();
+            // Tell submitters we are going to sleep and make sure they see it before we check the queues again
+            ++sleeping;
+            std::atomic_thread_fence(std::memory_order_seq_cst);
 
-        return task;
+            // Check again now we hold the lock, anything submitted after this will notify us once we are waiting
+            if (best_queue(local) == nullptr) {
+
+                // If the queue is empty we either wait or shutdown
+                if (!running) {
+                    --sleeping;
+
+                    // Notify any other threads that might be waiting on this condition
+                    condition.notify_all();
+
+                    // Return a nullptr to signify there is nothing on the queue
+                    return nullptr;
+                }
+
+                // Wait for something to happen!
+                condition.wait(lock);
+            }
+
+            // We are awake so start spinning again from the beginning
+            --sleeping;
+            idle = 0;
+        }
     }
 }  // namespace threading
 }  // namespace NUClear
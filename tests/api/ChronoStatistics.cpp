@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+NUClear::message::ChronoStatistics statistics;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Every<10, std::chrono::milliseconds>>().then([] {});
+
+        on<Trigger<NUClear::message::ChronoStatistics>>().then(
+            [this](const NUClear::message::ChronoStatistics& stats) {
+                statistics = stats;
+                powerplant.shutdown();
+            });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that the chrono controller reports its timing statistics", "[api][chrono]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // About a second of 10ms ticks should have been reported
+    REQUIRE(statistics.tasks > 50);
+    REQUIRE(statistics.max_lateness >= statistics.mean_lateness);
+    REQUIRE(statistics.mean_lateness >= NUClear::clock::duration(0));
+
+    // The spin window is calibrated but never grows past the configured bound
+    REQUIRE(statistics.spin_window <= config.timer_spin);
+}
+
+TEST_CASE("Testing that the chrono controller never spins when spinning is turned off", "[api][chrono]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    config.timer_spin   = NUClear::clock::duration(0);
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(statistics.tasks > 50);
+    REQUIRE(statistics.spin_window == NUClear::clock::duration(0));
+}
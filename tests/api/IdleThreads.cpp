@@ -0,0 +1,75 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct Ping {
+    int count;
+};
+struct Pong {
+    int count;
+};
+
+constexpr int bounces = 1000;
+int received          = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Each message is only emitted after the last one ran so every bounce must wake a thread
+        on<Trigger<Ping>>().then([this](const Ping& p) { emit(std::make_unique<Pong>(Pong{p.count + 1})); });
+
+        on<Trigger<Pong>>().then([this](const Pong& p) {
+            received = p.count;
+            if (p.count < bounces) {
+                emit(std::make_unique<Ping>(Ping{p.count}));
+            }
+            else {
+                powerplant.shutdown();
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that idle threads are woken without missing tasks", "[api][idle]") {
+
+    // Try going straight to sleep, and spinning and yielding first
+    for (size_t spin : {0, 1000}) {
+        for (size_t yield : {0, 10}) {
+
+            NUClear::PowerPlant::Configuration config;
+            config.thread_count     = 4;
+            config.idle_spin_count  = spin;
+            config.idle_yield_count = yield;
+            NUClear::PowerPlant plant(config);
+            plant.install<TestReactor>();
+
+            received = 0;
+            plant.emit(std::make_unique<Ping>(Ping{0}));
+            plant.start();
+
+            REQUIRE(received == bounces);
+        }
+    }
+}
@@ -0,0 +1,89 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+// Counts how many copies of itself are alive so we can check nothing is leaked or destroyed twice
+template <size_t N>
+struct Counted {
+    Counted(int& alive) : alive(&alive), padding() {
+        ++*this->alive;
+    }
+    Counted(const Counted& other) : alive(other.alive), padding() {
+        ++*alive;
+    }
+    Counted(Counted&& other) noexcept : alive(other.alive), padding() {
+        ++*alive;
+    }
+    ~Counted() {
+        --*alive;
+    }
+    int operator()(int x) {
+        return x + static_cast<int>(N);
+    }
+
+    int* alive;
+    char padding[N];
+};
+}  // namespace
+
+TEST_CASE("Testing that InlineFunction calls, moves and destroys small and large callables", "[api][inlinefunction]") {
+
+    using Small = Counted<8>;
+    using Large = Counted<256>;
+
+    int small_alive = 0;
+    int large_alive = 0;
+
+    {
+        NUClear::util::InlineFunction<int(int)> small{Small(small_alive)};
+        NUClear::util::InlineFunction<int(int)> large{Large(large_alive)};
+
+        REQUIRE(small);
+        REQUIRE(large);
+        REQUIRE(small(1) == 9);
+        REQUIRE(large(1) == 257);
+        REQUIRE(small_alive == 1);
+        REQUIRE(large_alive == 1);
+
+        // Moving leaves the source empty and keeps exactly one callable alive
+        NUClear::util::InlineFunction<int(int)> moved_small(std::move(small));
+        NUClear::util::InlineFunction<int(int)> moved_large;
+        moved_large = std::move(large);
+
+        REQUIRE_FALSE(small);
+        REQUIRE_FALSE(large);
+        REQUIRE(moved_small(2) == 10);
+        REQUIRE(moved_large(2) == 258);
+        REQUIRE(small_alive == 1);
+        REQUIRE(large_alive == 1);
+
+        // Assigning over a function destroys what it held
+        moved_small = std::move(moved_large);
+        REQUIRE(small_alive == 0);
+        REQUIRE(large_alive == 1);
+        REQUIRE(moved_small(3) == 259);
+    }
+
+    REQUIRE(small_alive == 0);
+    REQUIRE(large_alive == 0);
+}
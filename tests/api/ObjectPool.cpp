@@ -0,0 +1,93 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct Frame {
+    std::vector<uint8_t> data;
+};
+}  // namespace
+
+namespace NUClear {
+namespace dsl {
+    namespace trait {
+
+        template <>
+        struct is_pooled<Frame> : public std::true_type {};
+
+    }  // namespace trait
+}  // namespace dsl
+}  // namespace NUClear
+
+namespace {
+
+std::vector<const uint8_t*> buffers;
+std::vector<uint64_t> misses;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<NUClear::message::PoolStatistics>>().then([this](const NUClear::message::PoolStatistics& stats) {
+            misses.push_back(stats.misses);
+
+            if (stats.misses == 2) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 3; ++i) {
+                auto frame = NUClear::util::ObjectPool<Frame>::acquire();
+                frame->data.resize(1024 * 1024);
+                buffers.push_back(frame->data.data());
+
+                // This replaces the previous frame in the cache, giving it back to the pool
+                emit<Scope::DIRECT>(frame);
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that pooled messages are reused once they are released", "[api][pool]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // The third frame reused the first one along with its buffer
+    REQUIRE(buffers.size() == 3);
+    REQUIRE(buffers[0] == buffers[2]);
+    REQUIRE(buffers[0] != buffers[1]);
+
+    // Statistics were emitted for the two frames that had to be made
+    REQUIRE(misses == std::vector<uint64_t>({1, 2}));
+
+    auto stats = NUClear::util::ObjectPool<Frame>::statistics();
+    REQUIRE(stats.hits == 1);
+    REQUIRE(stats.misses == 2);
+    REQUIRE(stats.high_water == 2);
+}
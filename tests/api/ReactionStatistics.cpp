@@ -58,6 +58,11 @@ public:
             // If we are seeing the other reaction statistics handler, fail
             REQUIRE(stats.identifier[0] != "NoStats");
 
+            // Every task is timed whether or not it threw
+            REQUIRE(stats.emitted > NUClear::clock::time_point());
+            REQUIRE(stats.started >= stats.emitted);
+            REQUIRE(stats.finished >= stats.started);
+
             // Flag if we have seen the message handler
             if (stats.identifier[0] == "Message Handler") {
                 seen_message0 = true;
@@ -92,6 +97,31 @@ public:
         on<Startup>().then("Startup Handler", [this] { emit(std::make_unique<Message<0>>()); });
     }
 };
+
+bool checked_lazy_stats = false;
+
+class UnwatchedReactor : public NUClear::Reactor {
+public:
+    UnwatchedReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Startup>().then("Unwatched Handler", [this] {
+            auto task = NUClear::threading::ReactionTask::get_current_task();
+
+            // Nobody is listening for statistics so they should not have been made
+            REQUIRE(NUClear::threading::ReactionTask::statistics_listeners == 0);
+            REQUIRE(task->stats == nullptr);
+
+            // But they can still be made when they are needed
+            REQUIRE(task->get_stats()->identifier[0] == "Unwatched Handler");
+            REQUIRE(task->get_stats()->task_id == task->id);
+            REQUIRE(task->get_stats()->started == task->timing.started);
+            REQUIRE(task->get_stats()->started >= task->get_stats()->emitted);
+
+            checked_lazy_stats = true;
+            powerplant.shutdown();
+        });
+    }
+};
 }  // namespace
 
 TEST_CASE("Testing reaction statistics functionality", "[api][reactionstatistics]") {
@@ -105,3 +135,15 @@ TEST_CASE("Testing reaction statistics functionality", "[api][reactionstatistics
 
     plant.start();
 }
+
+TEST_CASE("Testing reaction statistics are only collected when something is listening", "[api][reactionstatistics]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<UnwatchedReactor>();
+
+    plant.start();
+
+    REQUIRE(checked_lazy_stats);
+}
@@ -0,0 +1,133 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct Message {
+    Message(int index) : index(index) {}
+    int index;
+};
+struct Custom {};
+struct High {};
+
+// A priority that sits between HIGH and NORMAL so it must be held outside of the standard priority rings
+struct Between {
+    template <typename DSL>
+    static inline int priority(NUClear::threading::Reaction&) {
+        return 600;
+    }
+};
+
+// More messages than fit in a single priority ring so some must overflow
+constexpr int message_count = 3000;
+
+std::vector<std::string> order;
+std::vector<int> indices;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<High>, Priority::HIGH>().then([] { order.push_back("High"); });
+
+        on<Trigger<Custom>, Between>().then([] { order.push_back("Custom"); });
+
+        on<Trigger<Message>, Priority::NORMAL>().then([this](const Message& m) {
+            if (indices.empty()) {
+                order.push_back("Normal");
+            }
+            indices.push_back(m.index);
+
+            if (indices.size() == message_count) {
+                powerplant.shutdown();
+            }
+        });
+    }
+};
+
+std::vector<uint64_t> pushed;
+std::vector<uint64_t> popped;
+
+// Uses a TaskQueue directly so we can choose exactly when tasks are pushed and popped
+class QueueReactor : public NUClear::Reactor {
+public:
+    QueueReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        NUClear::threading::Reaction reaction(*this, {"queue"}, nullptr);
+        NUClear::threading::TaskQueue queue(4);
+
+        const int priority = Priority::NORMAL::value;
+        auto push          = [&] {
+            auto task = std::make_unique<NUClear::threading::ReactionTask>(
+                reaction, priority, NUClear::threading::ReactionTask::TaskFunction());
+            pushed.push_back(task->id);
+            queue.push(std::move(task));
+        };
+
+        // Overfill the ring so the last two tasks overflow
+        for (int i = 0; i < 6; ++i) {
+            push();
+        }
+
+        // Make space in the ring and then push another task, it must still wait for the overflowed ones
+        popped.push_back(queue.pop()->id);
+        push();
+
+        for (auto task = queue.pop(); task; task = queue.pop()) {
+            popped.push_back(task->id);
+        }
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that tasks are ordered by priority and then by the order they were submitted", "[api][taskqueue]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    for (int i = 0; i < message_count; ++i) {
+        plant.emit(std::make_unique<Message>(i));
+    }
+    plant.emit(std::make_unique<Custom>());
+    plant.emit(std::make_unique<High>());
+
+    plant.start();
+
+    REQUIRE(order == std::vector<std::string>({"High", "Custom", "Normal"}));
+    REQUIRE(indices.size() == message_count);
+    for (int i = 0; i < message_count; ++i) {
+        REQUIRE(indices[i] == i);
+    }
+}
+
+TEST_CASE("Testing that tasks of the same priority stay in order after their ring overflows", "[api][taskqueue]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<QueueReactor>();
+
+    REQUIRE(pushed.size() == 7);
+    REQUIRE(popped == pushed);
+}
@@ -0,0 +1,77 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+template <int id>
+struct Message {};
+
+NUClear::clock::time_point start;
+NUClear::clock::time_point first;
+NUClear::clock::time_point second;
+std::vector<int> order;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Message<1>>>().then([] {
+            first = NUClear::clock::now();
+            order.push_back(1);
+        });
+
+        on<Trigger<Message<2>>>().then([this] {
+            second = NUClear::clock::now();
+            order.push_back(2);
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] {
+            start = NUClear::clock::now();
+
+            // These are close enough together that they should share a wake up
+            emit<Scope::DELAY>(std::make_unique<Message<1>>(), std::chrono::milliseconds(100));
+            emit<Scope::DELAY>(std::make_unique<Message<2>>(), std::chrono::milliseconds(130));
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that timer slack merges nearby timers into one wake up", "[api][chrono][slack]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    config.timer_slack  = std::chrono::milliseconds(50);
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Both ran in their due order
+    REQUIRE(order == std::vector<int>{1, 2});
+
+    // The first message waited in its slack for the second rather than having its own wake up
+    REQUIRE(first - start >= std::chrono::milliseconds(130));
+
+    // Slack only ever delays, nothing is run early
+    REQUIRE(second - start >= std::chrono::milliseconds(130));
+}
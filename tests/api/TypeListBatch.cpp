@@ -0,0 +1,90 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct Message {};
+
+int old_mode_runs = 0;
+int new_mode_runs = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        handles.push_back(on<Trigger<Message>>().then([this] { ++old_mode_runs; }));
+        handles.push_back(on<Trigger<Message>>().then([this] { ++old_mode_runs; }));
+
+        on<Startup>().then([this] {
+            using NUClear::dsl::store::TypeCallbackStore;
+
+            REQUIRE(TypeCallbackStore<Message>::get()->size() == 2);
+
+            // Switch modes in one go, nothing changes until the batch is finished
+            {
+                NUClear::util::TypeListBatch batch;
+
+                for (auto& h : handles) {
+                    h.unbind();
+                }
+                handles.clear();
+
+                // This one unbinds itself while a direct emit is still looping over the reactions
+                handles.push_back(on<Trigger<Message>>().then([this] {
+                    ++new_mode_runs;
+                    handles.front().unbind();
+                }));
+                handles.push_back(on<Trigger<Message>>().then([this] { ++new_mode_runs; }));
+                handles.push_back(on<Trigger<Message>>().then([this] { ++new_mode_runs; }));
+
+                REQUIRE(TypeCallbackStore<Message>::get()->size() == 2);
+            }
+
+            REQUIRE(TypeCallbackStore<Message>::get()->size() == 3);
+
+            emit<Scope::DIRECT>(std::make_unique<Message>());
+            REQUIRE(new_mode_runs == 3);
+            REQUIRE(TypeCallbackStore<Message>::get()->size() == 2);
+
+            emit<Scope::DIRECT>(std::make_unique<Message>());
+            REQUIRE(new_mode_runs == 5);
+            REQUIRE(old_mode_runs == 0);
+
+            powerplant.shutdown();
+        });
+    }
+
+private:
+    std::vector<ReactionHandle> handles;
+};
+}  // namespace
+
+TEST_CASE("Testing binding and unbinding reactions together in a batch", "[api][typelistbatch]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+}
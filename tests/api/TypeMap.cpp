@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct Value {
+    Value(int value, std::atomic<int>& alive) : value(value), alive(&alive) {
+        ++*this->alive;
+    }
+    Value(const Value&) = delete;
+    ~Value() {
+        --*alive;
+    }
+
+    int value;
+    std::atomic<int>* alive;
+};
+
+struct MapID {};
+
+using Map = NUClear::util::TypeMap<MapID, Value, Value>;
+}  // namespace
+
+TEST_CASE("Testing that TypeMap readers always see a whole value while it is being written", "[api][typemap]") {
+
+    constexpr int writes = 20000;
+    std::atomic<int> alive(0);
+    std::atomic<bool> done(false);
+    std::atomic<bool> ordered(true);
+
+    Map::set(std::make_shared<Value>(0, alive));
+
+    // Readers check that they never see a value go backwards or one that has been destroyed
+    std::vector<std::thread> readers;
+    for (int i = 0; i < 3; ++i) {
+        readers.emplace_back([&] {
+            int last = 0;
+            while (!done) {
+                std::shared_ptr<Value> v = Map::get();
+                if (!v || v->value < last) {
+                    ordered = false;
+                }
+                last = v ? v->value : last;
+            }
+        });
+    }
+
+    for (int i = 1; i <= writes; ++i) {
+        Map::set(std::make_shared<Value>(i, alive));
+    }
+
+    done = true;
+    for (auto& r : readers) {
+        r.join();
+    }
+
+    REQUIRE(ordered);
+    REQUIRE(Map::get()->value == writes);
+
+    // Only the current value is kept alive once nobody is reading anymore
+    Map::set(std::make_shared<Value>(-1, alive));
+    REQUIRE(alive == 1);
+}
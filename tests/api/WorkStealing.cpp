@@ -0,0 +1,117 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct Fan {
+    int depth;
+};
+
+struct Low {};
+struct Normal {};
+struct High {};
+
+std::atomic<int> finished(0);
+std::vector<std::string> order;
+std::mutex thread_mutex;
+std::set<std::thread::id> threads;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Each level fans out into two more tasks that are submitted from inside a pool thread
+        on<Trigger<Fan>>().then([this](const Fan& f) {
+
+            {
+                std::lock_guard<std::mutex> lock(thread_mutex);
+                threads.insert(std::this_thread::get_id());
+            }
+
+            // Give the other threads a chance to steal from us
+            std::this_thread::sleep_for(std::chrono::milliseconds(1));
+
+            if (f.depth < 6) {
+                emit(std::make_unique<Fan>(Fan{f.depth + 1}));
+                emit(std::make_unique<Fan>(Fan{f.depth + 1}));
+            }
+            // Once all 2^6 leaves have run we are done
+            else if (++finished == 64) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Fan>(Fan{0})); });
+    }
+};
+
+class PriorityReactor : public NUClear::Reactor {
+public:
+    PriorityReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Fan>>().then([this] {
+
+            // These all go into the local queue of this thread, in the wrong order
+            emit(std::make_unique<Low>());
+            emit(std::make_unique<Normal>());
+            emit(std::make_unique<High>());
+        });
+
+        on<Trigger<High>, Priority::HIGH>().then([this] { order.push_back("High"); });
+        on<Trigger<Normal>, Priority::NORMAL>().then([this] { order.push_back("Normal"); });
+        on<Trigger<Low>, Priority::LOW>().then([this] {
+            order.push_back("Low");
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<Fan>(Fan{0})); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that work stealing shares tasks submitted from inside reactions", "[api][workstealing]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count  = 4;
+    config.work_stealing = true;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Every task must have run, and the tasks created inside one thread must have been stolen by the others
+    REQUIRE(finished == 64);
+    REQUIRE(threads.size() > 1);
+}
+
+TEST_CASE("Testing that work stealing respects priority within a local queue", "[api][workstealing]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count  = 1;
+    config.work_stealing = true;
+    NUClear::PowerPlant plant(config);
+    plant.install<PriorityReactor>();
+
+    plant.start();
+
+    REQUIRE(order == std::vector<std::string>({"High", "Normal", "Low"}));
+}
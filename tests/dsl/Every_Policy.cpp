@@ -0,0 +1,88 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+std::vector<uint64_t> skipped;
+std::vector<NUClear::clock::time_point> aligned;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // The ticks that happen while we are sleeping can't run as we are Single, so they are counted as missed
+        on<Every<10, std::chrono::milliseconds, EveryPolicy::SKIP>, Single>().then([this](const EveryTick& tick) {
+            skipped.push_back(tick.missed);
+
+            if (skipped.size() == 1) {
+                std::this_thread::sleep_for(std::chrono::milliseconds(55));
+            }
+            else if (skipped.size() == 2) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Every<10, std::chrono::milliseconds, EveryPolicy::ALIGN>>().then(
+            [this](const EveryTick& tick) { aligned.push_back(tick.time); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the policies for missed Every<> ticks", "[api][every][policy]") {
+
+    using NUClear::dsl::word::every::Align;
+    using NUClear::dsl::word::every::CatchUp;
+    using NUClear::dsl::word::every::Skip;
+
+    const NUClear::clock::duration jump = std::chrono::milliseconds(10);
+    const NUClear::clock::time_point start(std::chrono::seconds(100));
+    const NUClear::clock::time_point now = start + std::chrono::milliseconds(35);
+
+    // Catch up moves one tick at a time, even if it is still in the past
+    NUClear::clock::time_point time = start;
+    REQUIRE(CatchUp::advance(time, now, jump) == 0);
+    REQUIRE(time == start + jump);
+
+    // Skip jumps to the first tick after now, counting the ones it passed
+    time = start;
+    REQUIRE(Skip::advance(time, now, jump) == 3);
+    REQUIRE(time == start + std::chrono::milliseconds(40));
+
+    // Align starts on the next multiple of the period
+    REQUIRE(Align::first(now, jump) == start + std::chrono::milliseconds(40));
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(skipped.size() == 2);
+    REQUIRE(skipped[0] == 0);
+    REQUIRE(skipped[1] >= 3);
+
+    REQUIRE(!aligned.empty());
+    for (const auto& t : aligned) {
+        REQUIRE(t.time_since_epoch() % jump == NUClear::clock::duration(0));
+    }
+}
@@ -0,0 +1,73 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct Image {
+    int camera_id;
+};
+
+struct Done {};
+
+struct IsCamera3 {
+    bool operator()(const Image& image) const {
+        return image.camera_id == 3;
+    }
+};
+
+std::vector<int> filtered;
+int unfiltered = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Image>, Filter<IsCamera3>>().then([this](const Image& image) {
+            filtered.push_back(image.camera_id);
+        });
+
+        on<Trigger<Image>>().then([this] { ++unfiltered; });
+
+        on<Trigger<Done>>().then([this] { powerplant.shutdown(); });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < 6; ++i) {
+                emit(std::make_unique<Image>(Image{i % 4}));
+            }
+            emit(std::make_unique<Done>());
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that Filter stops reactions running for data that fails the predicate", "[api][filter]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(unfiltered == 6);
+    REQUIRE(filtered == std::vector<int>({3}));
+}
@@ -0,0 +1,138 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+// Only linux watches file descriptors using epoll
+#ifdef __linux__
+
+#include <unistd.h>
+
+#include "nuclear"
+
+namespace {
+
+std::vector<std::string> events;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    /// @brief makes a pipe, moving its ends to the passed file descriptor numbers if they are given
+    static void make_pipe(int& in, int& out) {
+        int fds[2];
+        if (pipe(static_cast<int*>(fds)) < 0) {
+            FAIL("We couldn't make the pipe for the test");
+        }
+
+        // Make sure we reuse the old file descriptor numbers
+        if (in < 0) {
+            in  = fds[0];
+            out = fds[1];
+        }
+        if (fds[0] != in) {
+            dup2(fds[0], in);
+            ::close(fds[0]);
+        }
+        if (fds[1] != out) {
+            dup2(fds[1], out);
+            ::close(fds[1]);
+        }
+    }
+
+    static void send(int fd) {
+        unsigned char val = 0xDE;
+        REQUIRE(::write(fd, &val, 1) == 1);
+    }
+
+    static void receive(int fd) {
+        unsigned char val;
+        REQUIRE(::read(fd, &val, 1) == 1);
+        REQUIRE(val == 0xDE);
+    }
+
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Startup>().then([this] {
+            make_pipe(in, out);
+
+            first = on<IO>(in, IO::READ).then([this](const IO::Event& e) {
+                REQUIRE((e.events & IO::READ) != 0);
+                receive(e.fd);
+                events.push_back("first");
+
+                // Unbind before closing, this reaction must not run for the next pipe
+                first.unbind();
+                ::close(in);
+                ::close(out);
+
+                make_pipe(in, out);
+
+                second = on<IO>(in, IO::READ).then([this](const IO::Event& e) {
+                    // This reaction is left watching the closed fd, so it will also see the next pipe
+                    if (second_ran) {
+                        return;
+                    }
+                    second_ran = true;
+
+                    receive(e.fd);
+                    events.push_back("second");
+
+                    // Close without unbinding and reuse the fd number with the same events
+                    ::close(in);
+                    ::close(out);
+
+                    make_pipe(in, out);
+
+                    on<IO>(in, IO::READ).then([this](const IO::Event& e) {
+                        receive(e.fd);
+                        events.push_back("third");
+
+                        second.unbind();
+                        powerplant.shutdown();
+                    });
+
+                    send(out);
+                });
+
+                send(out);
+            });
+
+            send(out);
+        });
+    }
+
+    int in          = -1;
+    int out         = -1;
+    bool second_ran = false;
+    ReactionHandle first;
+    ReactionHandle second;
+};
+}  // namespace
+
+TEST_CASE("Testing the epoll IO controller unbinds and reuses file descriptors", "[api][io][epoll]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(events == std::vector<std::string>{"first", "second", "third"});
+}
+
+#endif
@@ -66,6 +66,18 @@ public:
 
         });
 
+        // The same history can be looked at through a view without copying it
+        on<Last<5, Trigger<TestMessage>>>().then([this](const LastView<std::shared_ptr<const TestMessage>>& messages) {
+
+            REQUIRE(messages.size() <= 5);
+
+            int i = messages.front()->value;
+            for (auto& m : messages) {
+                REQUIRE(m->value == i);
+                ++i;
+            }
+        });
+
         on<Startup>().then([this] { emit(std::make_unique<TestMessage>(++emit_counter)); });
     }
 };
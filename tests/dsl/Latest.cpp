@@ -0,0 +1,72 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct TestMessage {
+    int value;
+
+    TestMessage(int v) : value(v){};
+};
+
+struct Finished {};
+
+std::vector<int> values;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Latest<Trigger<TestMessage>>>().then([this](const TestMessage& m) {
+            values.push_back(m.value);
+
+            // Emitted while we are running so one more task is made that will see the newest of these
+            if (m.value == 5) {
+                emit(std::make_unique<TestMessage>(6));
+                emit(std::make_unique<TestMessage>(7));
+                emit(std::make_unique<Finished>());
+            }
+        });
+
+        on<Trigger<Finished>>().then([this] { powerplant.shutdown(); });
+
+        // These are all emitted before any of them can run so only the newest is processed
+        on<Startup>().then([this] {
+            for (int i = 1; i <= 5; ++i) {
+                emit(std::make_unique<TestMessage>(i));
+            }
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that Latest only processes the newest message", "[api][latest]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(values == std::vector<int>({5, 7}));
+}
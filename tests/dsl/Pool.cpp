@@ -0,0 +1,79 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct TestPool {
+    static constexpr size_t thread_count = 1;
+};
+
+struct PoolMessage {
+    PoolMessage(int count) : count(count) {}
+    int count;
+};
+
+constexpr int message_count = 10;
+
+std::thread::id main_pool_thread;
+std::set<std::thread::id> pool_threads;
+int received = 0;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<PoolMessage>, Pool<TestPool>>().then([this](const PoolMessage& m) {
+            pool_threads.insert(std::this_thread::get_id());
+
+            if (++received == message_count) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Trigger<int>>().then([this] {
+            main_pool_thread = std::this_thread::get_id();
+
+            for (int i = 0; i < message_count; ++i) {
+                emit(std::make_unique<PoolMessage>(i));
+            }
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<int>(0)); });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that reactions in a pool run on the threads of that pool", "[api][pool]") {
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(received == message_count);
+
+    // Everything ran on the single thread of the pool, which is not the main pools thread
+    REQUIRE(pool_threads.size() == 1);
+    REQUIRE(pool_threads.count(main_pool_thread) == 0);
+    REQUIRE(pool_threads.count(std::this_thread::get_id()) == 0);
+}
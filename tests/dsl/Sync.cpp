@@ -112,6 +112,87 @@ public:
         on<Startup>().then([this] { emit(std::make_unique<Message<0>>(123)); });
     }
 };
+
+struct BusyGroup {};
+struct Busy {};
+
+constexpr int busy_count = 1000;
+std::atomic<int> busy_running(0);
+std::atomic<bool> busy_overlapped(false);
+int busy_finished = 0;
+
+class BusyReactor : public NUClear::Reactor {
+public:
+    BusyReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<Busy>, Sync<BusyGroup>>().then([this] {
+
+            // Nothing else in the group may be running at the same time as us
+            if (++busy_running != 1) {
+                busy_overlapped = true;
+            }
+
+            if (++busy_finished == busy_count) {
+                powerplant.shutdown();
+            }
+
+            --busy_running;
+        });
+
+        on<Startup>().then([this] {
+            for (int i = 0; i < busy_count; ++i) {
+                emit(std::make_unique<Busy>());
+            }
+        });
+    }
+};
+
+struct MixedGroup {};
+struct OnMain {
+    OnMain(int val) : val(val) {}
+    int val;
+};
+struct OnPool {};
+
+constexpr int mixed_count = 10;
+std::atomic<int> mixed_finished(0);
+std::atomic<bool> mixed_wrong_thread(false);
+
+class MixedReactor : public NUClear::Reactor {
+public:
+    MixedReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<OnMain>, Sync<MixedGroup>, MainThread>().then([this](const OnMain& m) {
+            if (std::this_thread::get_id() != NUClear::util::main_thread_id) {
+                mixed_wrong_thread = true;
+            }
+
+            // These will be handed the group when we finish
+            if (m.val < mixed_count) {
+                emit(std::make_unique<OnPool>());
+                emit(std::make_unique<OnMain>(m.val + 1));
+            }
+
+            finish();
+        });
+
+        on<Trigger<OnPool>, Sync<MixedGroup>>().then([this] {
+            if (std::this_thread::get_id() == NUClear::util::main_thread_id) {
+                mixed_wrong_thread = true;
+            }
+
+            finish();
+        });
+
+        on<Startup>().then([this] { emit(std::make_unique<OnMain>(0)); });
+    }
+
+    void finish() {
+        if (++mixed_finished == mixed_count * 2 + 1) {
+            powerplant.shutdown();
+        }
+    }
+};
 }  // namespace
 
 TEST_CASE("Testing that the Sync word works correctly", "[api][sync]") {
@@ -123,3 +204,29 @@ TEST_CASE("Testing that the Sync word works correctly", "[api][sync]") {
 
     plant.start();
 }
+
+TEST_CASE("Testing that a busy Sync group runs every task one at a time", "[api][sync]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 4;
+    NUClear::PowerPlant plant(config);
+    plant.install<BusyReactor>();
+
+    plant.start();
+
+    REQUIRE(busy_finished == busy_count);
+    REQUIRE_FALSE(busy_overlapped);
+}
+
+TEST_CASE("Testing that a Sync group hands tasks to the right threads", "[api][sync]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 2;
+    NUClear::PowerPlant plant(config);
+    plant.install<MixedReactor>();
+
+    plant.start();
+
+    REQUIRE(mixed_finished == mixed_count * 2 + 1);
+    REQUIRE_FALSE(mixed_wrong_thread);
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct TestMessage {
+    int value;
+
+    TestMessage(int v) : value(v){};
+};
+
+std::vector<std::vector<int>> windows;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Window<50, std::chrono::milliseconds, Trigger<TestMessage>>>().then(
+            [this](const LastView<std::shared_ptr<const TestMessage>>& messages) {
+                std::vector<int> values;
+                for (const auto& m : messages) {
+                    values.push_back(m->value);
+                }
+                windows.push_back(values);
+            });
+
+        on<Startup>().then([this] {
+            // These all arrive within the window
+            emit<Scope::DIRECT>(std::make_unique<TestMessage>(1));
+            emit<Scope::DIRECT>(std::make_unique<TestMessage>(2));
+            emit<Scope::DIRECT>(std::make_unique<TestMessage>(3));
+
+            // By the time this arrives the others are too old
+            std::this_thread::sleep_for(std::chrono::milliseconds(100));
+            emit<Scope::DIRECT>(std::make_unique<TestMessage>(4));
+            emit<Scope::DIRECT>(std::make_unique<TestMessage>(5));
+
+            powerplant.shutdown();
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing the time window feature", "[api][window]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(windows.size() == 5);
+    REQUIRE(windows[0] == std::vector<int>({1}));
+    REQUIRE(windows[1] == std::vector<int>({1, 2}));
+    REQUIRE(windows[2] == std::vector<int>({1, 2, 3}));
+    REQUIRE(windows[3] == std::vector<int>({4}));
+    REQUIRE(windows[4] == std::vector<int>({4, 5}));
+}
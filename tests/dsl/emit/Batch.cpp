@@ -0,0 +1,82 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+struct BatchMessage {
+    BatchMessage(int value) : value(value) {}
+    int value;
+};
+
+struct Done {};
+
+constexpr int batch_size = 100;
+
+std::vector<int> received;
+std::vector<int> with_values;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<BatchMessage>>().then([this](const BatchMessage& m) { received.push_back(m.value); });
+
+        // By the time this runs every element has been set as the latest data
+        on<Trigger<Done>, With<BatchMessage>>().then([this](const BatchMessage& m) {
+            with_values.push_back(m.value);
+            powerplant.shutdown();
+        });
+
+        on<Startup>().then([this] {
+            std::vector<std::unique_ptr<BatchMessage>> batch;
+            for (int i = 0; i < batch_size; ++i) {
+                batch.push_back(std::make_unique<BatchMessage>(i));
+            }
+            emit<Scope::LOCAL>(std::move(batch));
+
+            // Emitting a batch without a scope works the same way
+            std::vector<std::unique_ptr<Done>> done;
+            done.push_back(std::make_unique<Done>());
+            emit(std::move(done));
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing emitting a batch of messages", "[api][emit][batch]") {
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    // Every message must arrive in the order it was in the batch
+    REQUIRE(received.size() == batch_size);
+    for (int i = 0; i < batch_size; ++i) {
+        REQUIRE(received[i] == i);
+    }
+
+    // The last element of the batch is the latest data
+    REQUIRE(with_values == std::vector<int>({batch_size - 1}));
+}
@@ -0,0 +1,102 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+namespace {
+
+struct TestMessage {
+    TestMessage(int a, int b) : value(a + b) {}
+
+    int value;
+};
+
+struct RecycledMessage {
+    RecycledMessage(int value) : value(value) {}
+
+    int value;
+};
+
+std::vector<int> values;
+std::vector<const RecycledMessage*> addresses;
+}  // namespace
+
+namespace NUClear {
+namespace dsl {
+    namespace trait {
+
+        template <>
+        struct allocator<RecycledMessage> {
+            using type = util::RecyclingAllocator<RecycledMessage>;
+        };
+
+    }  // namespace trait
+}  // namespace dsl
+}  // namespace NUClear
+
+namespace {
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        on<Trigger<TestMessage>>().then([this](const TestMessage& m) {
+            values.push_back(m.value);
+
+            if (m.value == 3) {
+                powerplant.shutdown();
+            }
+        });
+
+        on<Trigger<RecycledMessage>>().then([this](const RecycledMessage& m) {
+            values.push_back(m.value);
+            addresses.push_back(&m);
+        });
+
+        on<Startup>().then([this] {
+            emit_make<TestMessage, Scope::DIRECT>(1, 1);
+
+            // Each of these replaces the last in the cache, freeing it to be reused by the one after
+            emit_make<RecycledMessage, Scope::DIRECT>(10);
+            emit_make<RecycledMessage, Scope::DIRECT>(11);
+            emit_make<RecycledMessage, Scope::DIRECT>(12);
+
+            emit_make<TestMessage>(1, 2);
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing making messages in place when they are emitted", "[api][emit][make]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor>();
+
+    plant.start();
+
+    REQUIRE(values == std::vector<int>({2, 10, 11, 12, 3}));
+
+    // The first message's memory was given back to the allocator and used again for the third
+    REQUIRE(addresses.size() == 3);
+    REQUIRE(addresses[0] == addresses[2]);
+    REQUIRE(addresses[0] != addresses[1]);
+}
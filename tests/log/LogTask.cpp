@@ -0,0 +1,61 @@
+/*
+ * Copyright (C) 2013      Trent Houliston <trent@houliston.me>, Jake Woods <jake.f.woods@gmail.com>
+ *               2014-2017 Trent Houliston <trent@houliston.me>
+ *
+ * Permission is hereby granted, free of charge, to any person obtaining a copy of this software and associated
+ * documentation files (the "Software"), to deal in the Software without restriction, including without limitation the
+ * rights to use, copy, modify, merge, publish, distribute, sublicense, and/or sell copies of the Software, and to
+ * permit persons to whom the Software is furnished to do so, subject to the following conditions:
+ *
+ * The above copyright notice and this permission notice shall be included in all copies or substantial portions of the
+ * Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND, EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE
+ * WARRANTIES OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR
+ * COPYRIGHT HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY, WHETHER IN AN ACTION OF CONTRACT, TORT OR
+ * OTHERWISE, ARISING FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+#include <catch.hpp>
+
+#include "nuclear"
+
+// Anonymous namespace to keep everything file local
+namespace {
+
+std::shared_ptr<const NUClear::message::LogMessage> logged;
+
+class TestReactor : public NUClear::Reactor {
+public:
+    TestReactor(std::unique_ptr<NUClear::Environment> environment) : Reactor(std::move(environment)) {
+
+        // Keep the log message so we can look at it after the task that made it has gone
+        on<Trigger<NUClear::message::LogMessage>>().then(
+            [](std::shared_ptr<const NUClear::message::LogMessage> log_message) { logged = log_message; });
+
+        on<Trigger<int>>().then("Logging Handler", [this](const int& v) {
+            log<NUClear::INFO>("Got int:", v);
+            powerplant.shutdown();
+        });
+    }
+};
+}  // namespace
+
+TEST_CASE("Testing that log messages keep the statistics of the task that made them", "[api][log]") {
+
+    NUClear::PowerPlant::Configuration config;
+    config.thread_count = 1;
+    NUClear::PowerPlant plant(config);
+    plant.install<TestReactor, NUClear::DEBUG>();
+
+    plant.emit(std::make_unique<int>(5));
+
+    plant.start();
+
+    REQUIRE(logged);
+    REQUIRE(logged->message == "Got int: 5");
+    REQUIRE(logged->task);
+    REQUIRE(logged->task->identifier[0] == "Logging Handler");
+    REQUIRE(logged->task->emitted > NUClear::clock::time_point());
+    REQUIRE(logged->task->started >= logged->task->emitted);
+}